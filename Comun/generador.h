@@ -0,0 +1,201 @@
+#ifndef GENERADOR_H
+#define GENERADOR_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Generador de datos de prueba - Analisis y Diseño de Algoritmos
+
+Produce directamente en memoria las cuatro clases de entrada de las prácticas
+(aleatorios, ordenados, inversos y casi ordenados), en lugar de leerlas de los
+archivos de texto pregenerados o de reescribirlas con desOrdenPy/script.py.
+Con la misma semilla siempre se obtiene el mismo arreglo, así que los resultados
+se pueden reproducir sin guardar archivos de varios GB para n = 10^8.
+
+El generador pseudoaleatorio es xoshiro256** (Blackman y Vigna), sembrado con
+splitmix64: produce 64 bits por llamada con unas cuantas sumas, rotaciones y
+corrimientos, de modo que llenar un arreglo cuesta poco más que escribirlo.
+
+Uso:
+    ClaseEntrada clase;
+    claseDesdeTexto("casiOrdenados", &clase);
+    generarEnteros(arreglo, n, clase, semilla, 10);
+*/
+
+// Posiciones que se desordenan en la clase casiOrdenados si no se indica otra cantidad (como script.py)
+#define DESPLAZADOS_POR_DEFECTO 10
+
+typedef struct {
+    uint64_t s[4];   // Estado de xoshiro256**; nunca debe quedar todo en cero
+} GeneradorAleatorio;
+
+typedef enum {
+    CLASE_ALEATORIOS,
+    CLASE_ORDENADOS,
+    CLASE_INVERSOS,
+    CLASE_CASI_ORDENADOS
+} ClaseEntrada;
+
+// Nombres aceptados por claseDesdeTexto, en el orden de ClaseEntrada (los mismos que --clase)
+static const char *const NOMBRES_CLASE_ENTRADA[] = {"aleatorios", "ordenados", "inversos", "casiOrdenados"};
+
+static inline uint64_t rotarIzquierda64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/*
+void generadorSembrar(GeneradorAleatorio *g, uint64_t semilla)
+Recibe: GeneradorAleatorio *g (generador a inicializar), uint64_t semilla (cualquier valor, incluso 0)
+Devuelve: void (No retorna valor explícito)
+Observaciones: Expande la semilla con splitmix64 para llenar los 256 bits de estado; así semillas
+parecidas (1, 2, 3...) dan secuencias independientes.
+*/
+static inline void generadorSembrar(GeneradorAleatorio *g, uint64_t semilla) {
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (semilla += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        g->s[i] = z ^ (z >> 31);
+    }
+}
+
+/*
+uint64_t generadorSiguiente(GeneradorAleatorio *g)
+Recibe: GeneradorAleatorio *g
+Devuelve: uint64_t (siguientes 64 bits pseudoaleatorios)
+Observaciones: Paso de xoshiro256**.
+*/
+static inline uint64_t generadorSiguiente(GeneradorAleatorio *g) {
+    uint64_t *s = g->s;
+    uint64_t resultado = rotarIzquierda64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotarIzquierda64(s[3], 45);
+    return resultado;
+}
+
+/*
+uint32_t generadorRango(GeneradorAleatorio *g, uint32_t limite)
+Recibe: GeneradorAleatorio *g, uint32_t limite (mayor que 0)
+Devuelve: uint32_t (valor en [0, limite))
+Observaciones: Usa multiplicación y corrimiento en lugar de '%'. El sesgo es menor que
+limite / 2^32, despreciable para elegir posiciones de un arreglo.
+*/
+static inline uint32_t generadorRango(GeneradorAleatorio *g, uint32_t limite) {
+    return (uint32_t)(((generadorSiguiente(g) >> 32) * (uint64_t)limite) >> 32);
+}
+
+/*
+int claseDesdeTexto(const char *texto, ClaseEntrada *clase)
+Recibe: const char *texto ("aleatorios", "ordenados", "inversos" o "casiOrdenados"), ClaseEntrada *clase
+Devuelve: int (1 si el texto es una clase válida, 0 en caso contrario)
+Observaciones: Para la opción --generar de los programas.
+*/
+static inline int claseDesdeTexto(const char *texto, ClaseEntrada *clase) {
+    for (int i = 0; i < 4; i++) {
+        if (strcmp(texto, NOMBRES_CLASE_ENTRADA[i]) == 0) {
+            *clase = (ClaseEntrada)i;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+int desordenarPosiciones(int *arreglo, long long n, long long k, GeneradorAleatorio *g)
+Recibe: int *arreglo, long long n (tamaño), long long k (posiciones a desordenar), GeneradorAleatorio *g
+Devuelve: int (1 si se pudo reservar el mapa de posiciones, 0 en caso contrario)
+Observaciones: Mismo procedimiento que desOrdenPy/script.py: elige k posiciones distintas al azar
+y revuelve entre ellas los valores que contienen. El mapa de bits de n/8 bytes evita repetir
+posiciones sin importar el tamaño de k.
+*/
+static inline int desordenarPosiciones(int *arreglo, long long n, long long k, GeneradorAleatorio *g) {
+    if (k > n) {
+        k = n;
+    }
+    if (k < 2) {
+        return 1;
+    }
+    unsigned char *elegida = calloc((size_t)(n / 8 + 1), 1);
+    long long *posiciones = malloc((size_t)k * sizeof(long long));
+    if (elegida == NULL || posiciones == NULL) {
+        free(elegida);
+        free(posiciones);
+        return 0;
+    }
+
+    // Elegir k posiciones distintas (las posiciones quedan en el orden en que se eligieron)
+    for (long long i = 0; i < k; ) {
+        long long p = (long long)(((generadorSiguiente(g) >> 11) * (double)n) / 9007199254740992.0);
+        if (!(elegida[p >> 3] & (1u << (p & 7)))) {
+            elegida[p >> 3] |= (unsigned char)(1u << (p & 7));
+            posiciones[i++] = p;
+        }
+    }
+
+    // Fisher-Yates sobre los valores de esas posiciones
+    for (long long i = k - 1; i > 0; i--) {
+        long long j = (long long)(((generadorSiguiente(g) >> 11) * (double)(i + 1)) / 9007199254740992.0);
+        int temp = arreglo[posiciones[i]];
+        arreglo[posiciones[i]] = arreglo[posiciones[j]];
+        arreglo[posiciones[j]] = temp;
+    }
+
+    free(elegida);
+    free(posiciones);
+    return 1;
+}
+
+/*
+int generarEnteros(int *arreglo, long long n, ClaseEntrada clase, uint64_t semilla, long long desplazados)
+Recibe: int *arreglo (destino de n enteros), long long n, ClaseEntrada clase, uint64_t semilla,
+        long long desplazados (posiciones que se revuelven en CLASE_CASI_ORDENADOS; se ignora en las demás)
+Devuelve: int (1 si se generó el arreglo, 0 si faltó memoria para desordenar)
+Observaciones: Aleatorios: enteros no negativos de 31 bits (dos por cada llamada al generador).
+Ordenados: 0, 1, ..., n-1. Inversos: n-1, ..., 0. CasiOrdenados: ordenados con "desplazados"
+posiciones revueltas. Todas las clases llenan el arreglo en un solo recorrido secuencial.
+*/
+static inline int generarEnteros(int *arreglo, long long n, ClaseEntrada clase, uint64_t semilla,
+                                 long long desplazados) {
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+
+    switch (clase) {
+    case CLASE_ALEATORIOS: {
+        long long i = 0;
+        for (; i + 1 < n; i += 2) {
+            uint64_t x = generadorSiguiente(&g);
+            arreglo[i] = (int)(x >> 33);
+            arreglo[i + 1] = (int)((x >> 1) & 0x7FFFFFFF);
+        }
+        if (i < n) {
+            arreglo[i] = (int)(generadorSiguiente(&g) >> 33);
+        }
+        return 1;
+    }
+    case CLASE_ORDENADOS:
+        for (long long i = 0; i < n; i++) {
+            arreglo[i] = (int)i;
+        }
+        return 1;
+    case CLASE_INVERSOS:
+        for (long long i = 0; i < n; i++) {
+            arreglo[i] = (int)(n - 1 - i);
+        }
+        return 1;
+    case CLASE_CASI_ORDENADOS:
+        for (long long i = 0; i < n; i++) {
+            arreglo[i] = (int)i;
+        }
+        return desordenarPosiciones(arreglo, n, desplazados, &g);
+    }
+    return 0;
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef HILOS_H
+#define HILOS_H
+
+/*
+Utilidades de hilos - Analisis y Diseño de Algoritmos
+
+Los programas paralelos usan pthreads (en Windows, los de MinGW). Hay que agregar
+-pthread al compilar, por ejemplo:
+    gcc conteoInversiones.c -o merge -pthread
+*/
+
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+/*
+int numeroNucleos()
+Recibe: void (No recibe parámetros)
+Devuelve: int (número de procesadores en línea, al menos 1)
+Observaciones: Valor por defecto de la opción --hilos de los programas paralelos.
+*/
+static inline int numeroNucleos(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int nucleos = (int)info.dwNumberOfProcessors;
+#else
+    int nucleos = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return nucleos > 0 ? nucleos : 1;
+}
+
+/*
+int profundidadParaHilos(int hilos)
+Recibe: int hilos (número de hilos deseado)
+Devuelve: int (niveles de recursión en los que se crean tareas nuevas)
+Observaciones: Cada nivel de una recursión binaria duplica las tareas, así que con
+ceil(log2(hilos)) niveles se ocupan todos los hilos.
+*/
+static inline int profundidadParaHilos(int hilos) {
+    int profundidad = 0;
+    while ((1 << profundidad) < hilos) {
+        profundidad++;
+    }
+    return profundidad;
+}
+
+#endif
@@ -0,0 +1,385 @@
+#ifndef INTERVALOS_H
+#define INTERVALOS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Carga masiva de intervalos - Analisis y Diseño de Algoritmos
+
+Lee conjuntos grandes de intervalos (actividades, clases) de archivo a arreglos paralelos de
+enteros de 64 bits: id[i], inicio[i], fin[i] y peso[i] describen el intervalo i. Así los
+programas de la práctica 09 y 10 no dependen de arreglos escritos en main y los tiempos pueden
+ser marcas de tiempo reales (por ejemplo milisegundos desde 1970).
+
+Formatos:
+ - Texto (CSV): una fila por intervalo, "id,inicio,fin" o "id,inicio,fin,peso". Los campos se
+   separan con comas, punto y coma, espacios o tabuladores. Se ignoran las líneas vacías, las que
+   empiezan con '#' y una primera línea de encabezado (con letras). Sin peso, el peso es 1.
+   El archivo se lee en bloques de 1 MiB con fread y los números se convierten con un analizador
+   propio, como en lecturaEnteros.h.
+ - Binario ".ivl": encabezado de 16 bytes ("IVL1", banderas de 32 bits y la cantidad n de 64 bits)
+   seguido de las columnas completas una tras otra: n ids, n inicios, n fines y, si la bandera
+   BANDERA_IVL_PESO está encendida, n pesos, todos int64 en el orden de bytes de la máquina. Se lee
+   con un fread por columna directo a los arreglos.
+
+Horas de reloj: algunos datos escriben la hora como número, 9 o 930 para las 9:00 y 9:30, y sin
+indicar mañana o tarde (130 es la 1:30 de la tarde). intervalosNormalizarReloj los convierte a
+minutos desde la medianoche.
+
+Uso:
+    Intervalos iv;
+    if (!cargarIntervalos(ruta, &iv)) {
+        printf("Error: %s\n", iv.error);
+    }
+    intervalosNormalizarReloj(&iv, 8);   // Solo si los tiempos vienen como horas de reloj
+    ...
+    intervalosLiberar(&iv);
+*/
+
+// Tamaño de cada bloque de texto leído con fread (1 MiB)
+#define TAM_BLOQUE_INTERVALOS (1 << 20)
+
+// Una fila más larga que esto se considera un error de formato
+#define LONGITUD_MAXIMA_FILA 256
+
+// Bandera del encabezado ".ivl": el archivo trae la columna de pesos
+#define BANDERA_IVL_PESO 1u
+
+typedef struct {
+    int64_t *id;
+    int64_t *inicio;
+    int64_t *fin;
+    int64_t *peso;        // 1 en las filas que no traen peso
+    long long n;          // Intervalos cargados
+    long long capacidad;  // Lugares reservados en cada arreglo
+    int conPeso;          // 1 si alguna fila trajo peso
+    char error[128];      // Descripción del último error de carga
+} Intervalos;
+
+/*
+void intervalosIniciar(Intervalos *iv)
+Recibe: Intervalos *iv
+Devuelve: void (No retorna valor explícito)
+Observaciones: Deja el conjunto vacío y sin memoria reservada.
+*/
+static inline void intervalosIniciar(Intervalos *iv) {
+    iv->id = iv->inicio = iv->fin = iv->peso = NULL;
+    iv->n = iv->capacidad = 0;
+    iv->conPeso = 0;
+    iv->error[0] = '\0';
+}
+
+static inline void intervalosLiberar(Intervalos *iv) {
+    free(iv->id);
+    free(iv->inicio);
+    free(iv->fin);
+    free(iv->peso);
+    intervalosIniciar(iv);
+}
+
+/*
+int intervalosReservar(Intervalos *iv, long long capacidad)
+Recibe: Intervalos *iv, long long capacidad (lugares que deben caber)
+Devuelve: int (1 si los cuatro arreglos tienen al menos esa capacidad, 0 si falta memoria)
+Observaciones: Conserva los intervalos ya cargados. Si falla, los arreglos que sí crecieron quedan
+válidos y el conjunto conserva su capacidad anterior. Una capacidad cuyo tamaño en bytes no cabe
+en size_t se rechaza como falta de memoria.
+*/
+static inline int intervalosReservar(Intervalos *iv, long long capacidad) {
+    if (capacidad <= iv->capacidad) {
+        return 1;
+    }
+    if ((unsigned long long)capacidad > SIZE_MAX / sizeof(int64_t)) {
+        snprintf(iv->error, sizeof(iv->error), "no hay memoria para %lld intervalos", capacidad);
+        return 0;
+    }
+    int64_t **columnas[4] = {&iv->id, &iv->inicio, &iv->fin, &iv->peso};
+    for (int c = 0; c < 4; c++) {
+        int64_t *mayor = realloc(*columnas[c], (size_t)capacidad * sizeof(int64_t));
+        if (mayor == NULL) {
+            snprintf(iv->error, sizeof(iv->error), "no hay memoria para %lld intervalos", capacidad);
+            return 0;
+        }
+        *columnas[c] = mayor;
+    }
+    iv->capacidad = capacidad;
+    return 1;
+}
+
+/*
+int intervalosAgregar(Intervalos *iv, int64_t id, int64_t inicio, int64_t fin, int64_t peso)
+Recibe: Intervalos *iv, y los cuatro campos del intervalo
+Devuelve: int (1 si se agregó, 0 si falta memoria)
+Observaciones: La capacidad crece al doble, así que agregar n intervalos cuesta O(n).
+*/
+static inline int intervalosAgregar(Intervalos *iv, int64_t id, int64_t inicio, int64_t fin, int64_t peso) {
+    if (iv->n == iv->capacidad && !intervalosReservar(iv, iv->capacidad < 1024 ? 1024 : 2 * iv->capacidad)) {
+        return 0;
+    }
+    iv->id[iv->n] = id;
+    iv->inicio[iv->n] = inicio;
+    iv->fin[iv->n] = fin;
+    iv->peso[iv->n] = peso;
+    iv->n++;
+    return 1;
+}
+
+/*
+int filaIntervalo(const char *p, const char *finFila, int64_t campos[4])
+Recibe: const char *p y finFila (texto de una fila, sin el salto de línea), int64_t campos[4] (resultado)
+Devuelve: int (cantidad de números de la fila, o -1 si tiene algo que no es número ni separador)
+Observaciones: Acumula en uint64_t para que -2^63 no desborde. No revisa que los números quepan
+en 64 bits.
+*/
+static inline int filaIntervalo(const char *p, const char *finFila, int64_t campos[4]) {
+    int cantidad = 0;
+    while (p < finFila) {
+        char c = *p;
+        if (c == ',' || c == ';' || c == ' ' || c == '\t' || c == '\r') {
+            p++;
+            continue;
+        }
+        int negativo = (c == '-');
+        p += negativo;
+        if (p == finFila || (unsigned)(*p - '0') > 9 || cantidad == 4) {
+            return -1;
+        }
+        uint64_t acumulado = 0;
+        unsigned digito;
+        while (p < finFila && (digito = (unsigned)(*p - '0')) <= 9) {
+            acumulado = acumulado * 10 + digito;
+            p++;
+        }
+        campos[cantidad++] = (int64_t)(negativo ? 0 - acumulado : acumulado);
+    }
+    return cantidad;
+}
+
+/*
+int cargarIntervalosTexto(FILE *archivo, Intervalos *iv)
+Recibe: FILE *archivo (abierto en modo lectura), Intervalos *iv (vacío, recibe las filas)
+Devuelve: int (1 si se leyó todo el archivo, 0 si hubo un error de formato o de memoria)
+Observaciones: Ver el formato de texto al inicio. El error indica la línea donde ocurrió. No revisa
+que inicio <= fin, porque las horas de reloj pueden no cumplirlo antes de normalizarse.
+*/
+static inline int cargarIntervalosTexto(FILE *archivo, Intervalos *iv) {
+    char *bloque = malloc(TAM_BLOQUE_INTERVALOS);
+    if (bloque == NULL) {
+        snprintf(iv->error, sizeof(iv->error), "no hay memoria para el bloque de lectura");
+        return 0;
+    }
+    size_t pos = 0, lon = 0;
+    int agotado = 0, exito = 1;
+    long long linea = 0, filasConDatos = 0;
+    for (;;) {
+        // Ubicar la fila completa dentro del bloque; si no está, recorrer y leer más
+        char *inicioFila = bloque + pos;
+        char *salto = memchr(inicioFila, '\n', lon - pos);
+        if (salto == NULL && !agotado) {
+            memmove(bloque, inicioFila, lon - pos);
+            lon -= pos;
+            pos = 0;
+            size_t nuevos = fread(bloque + lon, 1, TAM_BLOQUE_INTERVALOS - lon, archivo);
+            agotado = nuevos == 0;
+            lon += nuevos;
+            continue;
+        }
+        if (salto == NULL && pos == lon) {
+            break;   // Fin del archivo justo después del último salto de línea
+        }
+        char *finFila = salto != NULL ? salto : bloque + lon;
+        pos = (size_t)(finFila - bloque) + (salto != NULL);
+        linea++;
+        if (finFila - inicioFila > LONGITUD_MAXIMA_FILA) {
+            snprintf(iv->error, sizeof(iv->error), "la línea %lld es demasiado larga", linea);
+            exito = 0;
+            break;
+        }
+
+        int64_t campos[4];
+        int cantidad = filaIntervalo(inicioFila, finFila, campos);
+        if (cantidad == 0 || *inicioFila == '#') {
+            continue;
+        }
+        if (cantidad < 0 && filasConDatos == 0 && linea == 1) {
+            continue;   // Encabezado
+        }
+        if (cantidad < 3) {
+            snprintf(iv->error, sizeof(iv->error), "la línea %lld no tiene la forma id,inicio,fin[,peso]", linea);
+            exito = 0;
+            break;
+        }
+        iv->conPeso |= cantidad == 4;
+        if (!intervalosAgregar(iv, campos[0], campos[1], campos[2], cantidad == 4 ? campos[3] : 1)) {
+            exito = 0;
+            break;
+        }
+        filasConDatos++;
+        if (salto == NULL) {
+            break;   // Última fila sin salto de línea
+        }
+    }
+    free(bloque);
+    return exito;
+}
+
+/*
+int esArchivoIntervalosBinario(const char *ruta)
+Recibe: const char *ruta (nombre del archivo)
+Devuelve: int (1 si la ruta termina en ".ivl", 0 en caso contrario)
+*/
+static inline int esArchivoIntervalosBinario(const char *ruta) {
+    size_t lon = strlen(ruta);
+    return lon >= 4 && strcmp(ruta + lon - 4, ".ivl") == 0;
+}
+
+/*
+int cargarIntervalosBinario(FILE *archivo, Intervalos *iv)
+Recibe: FILE *archivo (abierto en modo binario), Intervalos *iv (vacío)
+Devuelve: int (1 si se leyeron todas las columnas, 0 en caso contrario)
+Observaciones: Antes de reservar compara el n del encabezado con el tamaño del archivo, así un
+encabezado dañado no pide más memoria de la que el archivo puede llenar. Reserva exactamente n
+lugares y lee cada columna con un solo fread.
+*/
+static inline int cargarIntervalosBinario(FILE *archivo, Intervalos *iv) {
+    char firma[4];
+    uint32_t banderas;
+    int64_t n;
+    if (fread(firma, 1, 4, archivo) != 4 || memcmp(firma, "IVL1", 4) != 0 ||
+        fread(&banderas, sizeof(banderas), 1, archivo) != 1 || fread(&n, sizeof(n), 1, archivo) != 1 || n < 0) {
+        snprintf(iv->error, sizeof(iv->error), "el encabezado no es de un archivo .ivl");
+        return 0;
+    }
+    int conPeso = (banderas & BANDERA_IVL_PESO) != 0;
+    int cantidadColumnas = conPeso ? 4 : 3;
+    long encabezado = ftell(archivo);
+    long tamanio = fseek(archivo, 0, SEEK_END) == 0 ? ftell(archivo) : -1;
+    if (encabezado < 0 || tamanio < 0 || fseek(archivo, encabezado, SEEK_SET) != 0) {
+        snprintf(iv->error, sizeof(iv->error), "no se pudo medir el archivo .ivl");
+        return 0;
+    }
+    if (n > (tamanio - encabezado) / (long)(cantidadColumnas * sizeof(int64_t))) {
+        snprintf(iv->error, sizeof(iv->error), "el archivo trae menos de %lld intervalos", (long long)n);
+        return 0;
+    }
+    if (!intervalosReservar(iv, n > 0 ? n : 1)) {
+        return 0;
+    }
+    iv->conPeso = conPeso;
+    int64_t *columnas[4] = {iv->id, iv->inicio, iv->fin, iv->peso};
+    for (int c = 0; c < cantidadColumnas; c++) {
+        if (fread(columnas[c], sizeof(int64_t), (size_t)n, archivo) != (size_t)n) {
+            snprintf(iv->error, sizeof(iv->error), "el archivo trae menos de %lld intervalos", (long long)n);
+            return 0;
+        }
+    }
+    if (!iv->conPeso) {
+        for (int64_t i = 0; i < n; i++) {
+            iv->peso[i] = 1;
+        }
+    }
+    iv->n = n;
+    return 1;
+}
+
+/*
+int cargarIntervalos(const char *ruta, Intervalos *iv)
+Recibe: const char *ruta (archivo ".ivl", archivo de texto o NULL para la entrada estándar),
+        Intervalos *iv (se inicializa aquí)
+Devuelve: int (1 si se cargó el archivo completo, 0 en caso contrario; iv->error dice por qué)
+Observaciones: Punto de entrada común de los programas. Si falla, iv queda vacío pero el mensaje
+de error se conserva.
+*/
+static inline int cargarIntervalos(const char *ruta, Intervalos *iv) {
+    intervalosIniciar(iv);
+    int binario = ruta != NULL && esArchivoIntervalosBinario(ruta);
+    FILE *archivo = ruta == NULL ? stdin : fopen(ruta, binario ? "rb" : "r");
+    if (archivo == NULL) {
+        snprintf(iv->error, sizeof(iv->error), "no se pudo abrir %s", ruta);
+        return 0;
+    }
+    int exito = binario ? cargarIntervalosBinario(archivo, iv) : cargarIntervalosTexto(archivo, iv);
+    if (archivo != stdin) {
+        fclose(archivo);
+    }
+    if (!exito) {
+        char error[sizeof(iv->error)];
+        memcpy(error, iv->error, sizeof(error));
+        intervalosLiberar(iv);
+        memcpy(iv->error, error, sizeof(error));
+    }
+    return exito;
+}
+
+/*
+int guardarIntervalosBinario(const char *ruta, const Intervalos *iv)
+Recibe: const char *ruta (archivo ".ivl" a crear), const Intervalos *iv
+Devuelve: int (1 si se escribió completo, 0 en caso contrario)
+Observaciones: Genera el cache binario que después se puede pasar a cargarIntervalos. La columna
+de pesos solo se escribe si el conjunto tiene pesos.
+*/
+static inline int guardarIntervalosBinario(const char *ruta, const Intervalos *iv) {
+    FILE *archivo = fopen(ruta, "wb");
+    if (archivo == NULL) {
+        return 0;
+    }
+    uint32_t banderas = iv->conPeso ? BANDERA_IVL_PESO : 0;
+    int64_t n = iv->n;
+    int exito = fwrite("IVL1", 1, 4, archivo) == 4 && fwrite(&banderas, sizeof(banderas), 1, archivo) == 1 &&
+                fwrite(&n, sizeof(n), 1, archivo) == 1;
+    const int64_t *columnas[4] = {iv->id, iv->inicio, iv->fin, iv->peso};
+    for (int c = 0; exito && c < (iv->conPeso ? 4 : 3); c++) {
+        exito = fwrite(columnas[c], sizeof(int64_t), (size_t)n, archivo) == (size_t)n;
+    }
+    exito = fclose(archivo) == 0 && exito;
+    return exito;
+}
+
+/*
+int64_t minutosDeReloj(int64_t hora, int horaTarde)
+Recibe: int64_t hora (9 o 930: hasta 24 son horas completas; si no, las dos últimas cifras son los
+        minutos), int horaTarde (las horas menores que esta son de la tarde; 0 para reloj de 24 horas)
+Devuelve: int64_t (minutos desde la medianoche)
+Observaciones: Con horaTarde = 8, 130 es la 1:30 de la tarde (810 minutos) y 1230 son las 12:30 (750).
+*/
+static inline int64_t minutosDeReloj(int64_t hora, int horaTarde) {
+    int64_t horas = hora <= 24 ? hora : hora / 100;
+    int64_t minutos = hora <= 24 ? 0 : hora % 100;
+    if (horas < horaTarde) {
+        horas += 12;
+    }
+    return horas * 60 + minutos;
+}
+
+/*
+void intervalosNormalizarReloj(Intervalos *iv, int horaTarde)
+Recibe: Intervalos *iv, int horaTarde (ver minutosDeReloj)
+Devuelve: void (No retorna valor explícito)
+Observaciones: Convierte inicio y fin de todos los intervalos a minutos desde la medianoche.
+*/
+static inline void intervalosNormalizarReloj(Intervalos *iv, int horaTarde) {
+    for (long long i = 0; i < iv->n; i++) {
+        iv->inicio[i] = minutosDeReloj(iv->inicio[i], horaTarde);
+        iv->fin[i] = minutosDeReloj(iv->fin[i], horaTarde);
+    }
+}
+
+/*
+long long intervaloInvalido(const Intervalos *iv)
+Recibe: const Intervalos *iv
+Devuelve: long long (posición del primer intervalo que termina antes de empezar, o -1 si no hay)
+Observaciones: Se llama después de intervalosNormalizarReloj, si se usa.
+*/
+static inline long long intervaloInvalido(const Intervalos *iv) {
+    for (long long i = 0; i < iv->n; i++) {
+        if (iv->fin[i] < iv->inicio[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif
@@ -0,0 +1,282 @@
+#ifndef LECTURA_ENTEROS_H
+#define LECTURA_ENTEROS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Lectura masiva de enteros - Analisis y Diseño de Algoritmos
+
+Sustituye la lectura elemento por elemento con scanf("%d", ...) de los programas
+de ordenamiento. El archivo se lee en bloques grandes con fread y cada entero se
+convierte con un analizador decimal propio, sin pasar por el interprete de formato
+de scanf. Tambien se soporta un formato binario ".i32" (enteros de 32 bits en el
+orden de bytes de la maquina, sin encabezado) para que las corridas repetidas se
+salten por completo la conversion de texto.
+
+Es un archivo de solo encabezado: basta con incluirlo, la forma de compilar los
+programas no cambia.
+
+Uso:
+    LectorEnteros lector;
+    lectorAbrir(&lector, stdin);
+    long long leidos = lectorLeer(&lector, arreglo, n);
+    lectorCerrar(&lector);
+*/
+
+// Tamaño de cada bloque leido con fread (1 MiB)
+#define TAM_BLOQUE_LECTURA (1 << 20)
+
+// Bytes minimos que deben quedar en el bloque para convertir un entero sin revisar limites
+#define HOLGURA_LECTURA 32
+
+typedef struct {
+    FILE *archivo;   // Archivo de donde se leen los datos
+    char *bloque;    // Bloque de TAM_BLOQUE_LECTURA bytes mas un centinela '\0'
+    size_t pos;      // Siguiente byte por procesar dentro del bloque
+    size_t lon;      // Bytes validos en el bloque
+    int agotado;     // 1 cuando fread ya no tiene mas datos que entregar
+    long long fueraDeRango;   // Numeros saltados por no caber en un int
+} LectorEnteros;
+
+/*
+int lectorAbrir(LectorEnteros *lector, FILE *archivo)
+Recibe: LectorEnteros *lector (lector a inicializar), FILE *archivo (archivo ya abierto en modo lectura)
+Devuelve: int (1 si se pudo reservar el bloque, 0 en caso contrario)
+Observaciones: No toma posesion del archivo; cerrarlo sigue siendo responsabilidad de quien lo abrio.
+*/
+static inline int lectorAbrir(LectorEnteros *lector, FILE *archivo) {
+    lector->archivo = archivo;
+    lector->bloque = malloc(TAM_BLOQUE_LECTURA + 1);
+    lector->pos = 0;
+    lector->lon = 0;
+    lector->agotado = 0;
+    lector->fueraDeRango = 0;
+    if (lector->bloque == NULL) {
+        return 0;
+    }
+    lector->bloque[0] = '\0';
+    return 1;
+}
+
+/*
+void lectorCerrar(LectorEnteros *lector)
+Recibe: LectorEnteros *lector (lector a liberar)
+Devuelve: void (No retorna valor explícito)
+Observaciones: Libera el bloque de lectura.
+*/
+static inline void lectorCerrar(LectorEnteros *lector) {
+    free(lector->bloque);
+    lector->bloque = NULL;
+}
+
+/*
+void lectorRellenar(LectorEnteros *lector)
+Recibe: LectorEnteros *lector
+Devuelve: void (No retorna valor explícito)
+Observaciones: Recorre al inicio del bloque los bytes pendientes y completa el resto con fread.
+Siempre deja un '\0' despues del ultimo byte valido, que sirve de centinela al convertir digitos.
+*/
+static inline void lectorRellenar(LectorEnteros *lector) {
+    size_t resto = lector->lon - lector->pos;
+    memmove(lector->bloque, lector->bloque + lector->pos, resto);
+    size_t nuevos = fread(lector->bloque + resto, 1, TAM_BLOQUE_LECTURA - resto, lector->archivo);
+    if (nuevos == 0) {
+        lector->agotado = 1;
+    }
+    lector->pos = 0;
+    lector->lon = resto + nuevos;
+    lector->bloque[lector->lon] = '\0';
+}
+
+/*
+int lectorSiguiente(LectorEnteros *lector, int *valor)
+Recibe: LectorEnteros *lector, int *valor (donde se guarda el entero leido)
+Devuelve: int (1 si se leyo un entero, 0 si se termino el archivo)
+Observaciones: Ignora cualquier caracter que no sea digito o signo '-' entre numeros (espacios,
+saltos de linea, comas, bytes '\0'). Un numero que no cabe en un int se salta con un aviso en
+stderr y se cuenta en lector->fueraDeRango, en lugar de devolverlo truncado.
+*/
+static inline int lectorSiguiente(LectorEnteros *lector, int *valor) {
+    for (;;) {
+        // Saltar separadores hasta el final de los bytes validos (un '\0' del archivo es separador)
+        const char *p = lector->bloque + lector->pos;
+        const char *fin = lector->bloque + lector->lon;
+        while (p < fin && *p != '-' && (unsigned)(*p - '0') > 9) {
+            p++;
+        }
+        lector->pos = (size_t)(p - lector->bloque);
+
+        if (lector->pos >= lector->lon) {
+            if (lector->agotado) {
+                return 0;
+            }
+            lectorRellenar(lector);
+            continue;
+        }
+
+        // Garantizar que el numero completo este dentro del bloque
+        if (lector->lon - lector->pos < HOLGURA_LECTURA && !lector->agotado) {
+            lectorRellenar(lector);
+            p = lector->bloque;
+        }
+
+        int negativo = (*p == '-');
+        p += negativo;
+        if ((unsigned)(*p - '0') > 9) {
+            // Un '-' suelto no es un numero, se trata como separador
+            lector->pos = (size_t)(p - lector->bloque);
+            continue;
+        }
+
+        // Se deja de acumular al pasar de 2^31, asi que ningun numero de digitos desborda
+        unsigned long long acumulado = 0;
+        unsigned int digito;
+        for (;;) {
+            while ((digito = (unsigned)(*p - '0')) <= 9) {
+                if (acumulado <= 2147483648ull) {
+                    acumulado = acumulado * 10 + digito;
+                }
+                p++;
+            }
+            if (p != lector->bloque + lector->lon || lector->agotado) {
+                break;
+            }
+            // Los digitos siguen en el siguiente bloque (solo pasa con numeros mas largos que la holgura)
+            lector->pos = lector->lon;
+            lectorRellenar(lector);
+            p = lector->bloque;
+        }
+        lector->pos = (size_t)(p - lector->bloque);
+        if (acumulado > (negativo ? 2147483648ull : 2147483647ull)) {
+            lector->fueraDeRango++;
+            fprintf(stderr, "Aviso: se ignora un numero fuera del rango de int\n");
+            continue;
+        }
+        *valor = (int)(negativo ? 0 - (long long)acumulado : (long long)acumulado);
+        return 1;
+    }
+}
+
+/*
+long long lectorLeer(LectorEnteros *lector, int *destino, long long n)
+Recibe: LectorEnteros *lector, int *destino (arreglo de al menos n enteros), long long n (cantidad a leer)
+Devuelve: long long (cantidad de enteros realmente leidos, menor que n si el archivo se termino antes)
+Observaciones: Puede llamarse varias veces sobre el mismo lector para leer el archivo por partes.
+*/
+static inline long long lectorLeer(LectorEnteros *lector, int *destino, long long n) {
+    long long i = 0;
+    while (i < n && lectorSiguiente(lector, &destino[i])) {
+        i++;
+    }
+    return i;
+}
+
+/*
+int esArchivoBinario(const char *ruta)
+Recibe: const char *ruta (nombre del archivo)
+Devuelve: int (1 si la ruta termina en ".i32", 0 en caso contrario)
+Observaciones: La extension es la que decide si el archivo se interpreta como texto o binario.
+*/
+static inline int esArchivoBinario(const char *ruta) {
+    size_t lon = strlen(ruta);
+    return lon >= 4 && strcmp(ruta + lon - 4, ".i32") == 0;
+}
+
+typedef struct {
+    FILE *archivo;          // Archivo abierto (o stdin)
+    int binario;            // 1 si es un archivo ".i32"
+    LectorEnteros lector;   // Solo se usa con archivos de texto
+} FuenteEnteros;
+
+/*
+int fuenteAbrir(FuenteEnteros *fuente, const char *ruta)
+Recibe: FuenteEnteros *fuente (fuente a inicializar), const char *ruta (archivo de texto, archivo ".i32"
+        o NULL para la entrada estandar)
+Devuelve: int (1 si se pudo abrir, 0 en caso contrario)
+Observaciones: Permite leer un archivo por partes sin importar su formato, por ejemplo cuando los datos
+no caben completos en memoria.
+*/
+static inline int fuenteAbrir(FuenteEnteros *fuente, const char *ruta) {
+    fuente->binario = (ruta != NULL && esArchivoBinario(ruta));
+    fuente->lector.bloque = NULL;
+    if (ruta == NULL) {
+        fuente->archivo = stdin;
+    } else {
+        fuente->archivo = fopen(ruta, fuente->binario ? "rb" : "r");
+        if (fuente->archivo == NULL) {
+            return 0;
+        }
+    }
+    if (!fuente->binario && !lectorAbrir(&fuente->lector, fuente->archivo)) {
+        if (fuente->archivo != stdin) {
+            fclose(fuente->archivo);
+        }
+        return 0;
+    }
+    return 1;
+}
+
+/*
+long long fuenteLeer(FuenteEnteros *fuente, int *destino, long long n)
+Recibe: FuenteEnteros *fuente, int *destino (arreglo de al menos n enteros), long long n (cantidad a leer)
+Devuelve: long long (cantidad de enteros leidos; 0 cuando ya no hay datos)
+Observaciones: Los archivos ".i32" se leen con fread directo al destino.
+*/
+static inline long long fuenteLeer(FuenteEnteros *fuente, int *destino, long long n) {
+    if (fuente->binario) {
+        return (long long)fread(destino, sizeof(int), (size_t)n, fuente->archivo);
+    }
+    return lectorLeer(&fuente->lector, destino, n);
+}
+
+/*
+void fuenteCerrar(FuenteEnteros *fuente)
+Recibe: FuenteEnteros *fuente
+Devuelve: void (No retorna valor explícito)
+Observaciones: Cierra el archivo salvo que sea la entrada estandar.
+*/
+static inline void fuenteCerrar(FuenteEnteros *fuente) {
+    if (!fuente->binario) {
+        lectorCerrar(&fuente->lector);
+    }
+    if (fuente->archivo != stdin) {
+        fclose(fuente->archivo);
+    }
+}
+
+/*
+long long cargarEnteros(const char *ruta, int *arreglo, long long n)
+Recibe: const char *ruta (archivo de texto, archivo ".i32" o NULL para la entrada estandar),
+        int *arreglo (destino), long long n (cantidad de enteros a leer)
+Devuelve: long long (cantidad de enteros leidos, o -1 si el archivo no se pudo abrir)
+Observaciones: Punto de entrada comun de los programas; los archivos ".i32" se leen con un solo fread.
+*/
+static inline long long cargarEnteros(const char *ruta, int *arreglo, long long n) {
+    FuenteEnteros fuente;
+    if (!fuenteAbrir(&fuente, ruta)) {
+        return -1;
+    }
+    long long leidos = fuenteLeer(&fuente, arreglo, n);
+    fuenteCerrar(&fuente);
+    return leidos;
+}
+
+/*
+int guardarEnterosBinario(const char *ruta, const int *arreglo, long long n)
+Recibe: const char *ruta (archivo ".i32" a crear), const int *arreglo, long long n (cantidad de enteros)
+Devuelve: int (1 si se escribieron los n enteros, 0 en caso contrario)
+Observaciones: Genera el cache binario que despues se puede pasar a cargarEnteros.
+*/
+static inline int guardarEnterosBinario(const char *ruta, const int *arreglo, long long n) {
+    FILE *archivo = fopen(ruta, "wb");
+    if (archivo == NULL) {
+        return 0;
+    }
+    size_t escritos = fwrite(arreglo, sizeof(int), (size_t)n, archivo);
+    fclose(archivo);
+    return escritos == (size_t)n;
+}
+
+#endif
@@ -0,0 +1,223 @@
+#ifndef MEDICION_H
+#define MEDICION_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+Medición de tiempos - Analisis y Diseño de Algoritmos
+
+Reemplaza el patrón "t = clock(); ...; t = clock() - t;" de las prácticas:
+ - Usa un reloj monotónico de alta resolución (clock_gettime(CLOCK_MONOTONIC), o
+   QueryPerformanceCounter en Windows) en lugar de clock(), que mide tiempo de CPU
+   con resolución de milisegundos y suma el tiempo de todos los hilos.
+ - Ejecuta corridas de calentamiento que no se cuentan y varias repeticiones medidas,
+   y reporta mínimo, mediana, percentil 99 y promedio.
+ - Emite los resultados como filas CSV o JSON (una por línea) identificadas por
+   algoritmo, n y clase de entrada, para no tener que extraerlos con expresiones regulares.
+ - Ofrece barreras de compilador para que ciclos como "j++" no se eliminen con -O2.
+
+Uso:
+    Medicion m;
+    medicionCrear(&m, calentamiento, repeticiones);
+    medir(&m, prepararCopia, ordenar, &datos);   // prepararCopia no se mide
+    imprimirMedicion(FORMATO_CSV, "introsort", n, "aleatorios", &m);
+    medicionLiberar(&m);
+*/
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#endif
+
+/*
+double tiempoMonotonico()
+Recibe: void (No recibe parámetros)
+Devuelve: double (segundos desde un origen arbitrario pero fijo)
+Observaciones: Solo sirve para restar dos lecturas. No retrocede si se ajusta la hora del sistema.
+*/
+static inline double tiempoMonotonico(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frecuencia;
+    LARGE_INTEGER contador;
+    if (frecuencia.QuadPart == 0) {
+        QueryPerformanceFrequency(&frecuencia);
+    }
+    QueryPerformanceCounter(&contador);
+    return (double)contador.QuadPart / (double)frecuencia.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+#endif
+}
+
+/*
+unsigned long long ciclosCPU()
+Recibe: void (No recibe parámetros)
+Devuelve: unsigned long long (contador de ciclos del procesador con rdtsc; en otras arquitecturas,
+          nanosegundos del reloj monotónico)
+Observaciones: Útil para medir fragmentos muy cortos. El contador de ciclos puede no ser comparable
+entre núcleos, así que conviene usarlo dentro de un mismo hilo.
+*/
+static inline unsigned long long ciclosCPU(void) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    return (unsigned long long)__rdtsc();
+#else
+    return (unsigned long long)(tiempoMonotonico() * 1e9);
+#endif
+}
+
+/*
+BARRERA_COMPILADOR() impide que el compilador mueva lecturas o escrituras de memoria a través de ella.
+MANTENER(x) obliga a que x exista en un registro en ese punto, así que el cálculo que lo produce no
+puede eliminarse ni sacarse del ciclo.
+*/
+#if defined(__GNUC__)
+#define BARRERA_COMPILADOR() __asm__ __volatile__("" ::: "memory")
+#define MANTENER(x) __asm__ __volatile__("" : "+r"(x))
+#else
+static volatile long long sumideroMedicion;
+#define BARRERA_COMPILADOR() ((void)0)
+#define MANTENER(x) (sumideroMedicion = (long long)(x))
+#endif
+
+typedef enum {
+    FORMATO_TEXTO,
+    FORMATO_CSV,
+    FORMATO_JSON
+} FormatoMedicion;
+
+typedef struct {
+    int calentamiento;   // Corridas previas que no se miden
+    int repeticiones;    // Corridas medidas
+    double *tiempos;     // Segundos de cada repetición, ordenados al terminar medir()
+    double minimo;
+    double mediana;
+    double p99;
+    double promedio;
+} Medicion;
+
+// Función que se mide, o que prepara los datos antes de cada corrida
+typedef void (*FuncionMedible)(void *datos);
+
+/*
+int medicionCrear(Medicion *m, int calentamiento, int repeticiones)
+Recibe: Medicion *m, int calentamiento (corridas sin medir), int repeticiones (corridas medidas, al menos 1)
+Devuelve: int (1 si se pudo reservar memoria, 0 en caso contrario)
+Observaciones: Una misma Medicion se puede reutilizar en varias llamadas a medir().
+*/
+static inline int medicionCrear(Medicion *m, int calentamiento, int repeticiones) {
+    m->calentamiento = calentamiento < 0 ? 0 : calentamiento;
+    m->repeticiones = repeticiones < 1 ? 1 : repeticiones;
+    m->tiempos = malloc((size_t)m->repeticiones * sizeof(double));
+    m->minimo = m->mediana = m->p99 = m->promedio = 0;
+    return m->tiempos != NULL;
+}
+
+static inline void medicionLiberar(Medicion *m) {
+    free(m->tiempos);
+    m->tiempos = NULL;
+}
+
+static inline int compararTiempos(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+void medir(Medicion *m, FuncionMedible preparar, FuncionMedible ejecutar, void *datos)
+Recibe: Medicion *m, FuncionMedible preparar (puede ser NULL; se llama antes de cada corrida y no se mide),
+        FuncionMedible ejecutar (lo que se mide), void *datos (se pasa a ambas funciones)
+Devuelve: void (No retorna valor explícito)
+Observaciones: Por ejemplo, preparar copia el arreglo original para que cada repetición de un
+ordenamiento trabaje sobre los mismos datos desordenados. Al terminar calcula las estadísticas;
+el percentil 99 es por rango más cercano (con pocas repeticiones coincide con el máximo).
+*/
+static inline void medir(Medicion *m, FuncionMedible preparar, FuncionMedible ejecutar, void *datos) {
+    for (int i = 0; i < m->calentamiento; i++) {
+        if (preparar != NULL) {
+            preparar(datos);
+        }
+        ejecutar(datos);
+    }
+
+    double suma = 0;
+    for (int i = 0; i < m->repeticiones; i++) {
+        if (preparar != NULL) {
+            preparar(datos);
+        }
+        BARRERA_COMPILADOR();
+        double inicio = tiempoMonotonico();
+        ejecutar(datos);
+        BARRERA_COMPILADOR();
+        m->tiempos[i] = tiempoMonotonico() - inicio;
+        suma += m->tiempos[i];
+    }
+
+    qsort(m->tiempos, (size_t)m->repeticiones, sizeof(double), compararTiempos);
+    int r = m->repeticiones;
+    m->minimo = m->tiempos[0];
+    m->mediana = (r % 2) ? m->tiempos[r / 2] : (m->tiempos[r / 2 - 1] + m->tiempos[r / 2]) / 2;
+    int rango = (99 * r + 99) / 100;   // ceil(0.99 * r)
+    m->p99 = m->tiempos[rango - 1];
+    m->promedio = suma / r;
+}
+
+/*
+int formatoDesdeTexto(const char *texto, FormatoMedicion *formato)
+Recibe: const char *texto ("texto", "csv" o "json"), FormatoMedicion *formato (resultado)
+Devuelve: int (1 si el texto es un formato válido, 0 en caso contrario)
+Observaciones: Para la opción --formato de los programas.
+*/
+static inline int formatoDesdeTexto(const char *texto, FormatoMedicion *formato) {
+    if (strcmp(texto, "texto") == 0) {
+        *formato = FORMATO_TEXTO;
+    } else if (strcmp(texto, "csv") == 0) {
+        *formato = FORMATO_CSV;
+    } else if (strcmp(texto, "json") == 0) {
+        *formato = FORMATO_JSON;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+/*
+void imprimirEncabezadoMedicion(FormatoMedicion formato)
+Recibe: FormatoMedicion formato
+Devuelve: void (No retorna valor explícito)
+Observaciones: Solo el formato CSV lleva encabezado; JSON emite un objeto independiente por línea.
+*/
+static inline void imprimirEncabezadoMedicion(FormatoMedicion formato) {
+    if (formato == FORMATO_CSV) {
+        printf("algoritmo,n,clase,repeticiones,min_s,mediana_s,p99_s,promedio_s\n");
+    }
+}
+
+/*
+void imprimirMedicion(FormatoMedicion formato, const char *algoritmo, long long n, const char *clase, const Medicion *m)
+Recibe: FormatoMedicion formato, const char *algoritmo, long long n (tamaño de la entrada),
+        const char *clase (clase de entrada: aleatorios, ordenados, inversos...), const Medicion *m
+Devuelve: void (No retorna valor explícito)
+Observaciones: En FORMATO_TEXTO no imprime nada; cada programa conserva su línea de texto propia
+para no romper los scripts que ya la procesan.
+*/
+static inline void imprimirMedicion(FormatoMedicion formato, const char *algoritmo, long long n,
+                                    const char *clase, const Medicion *m) {
+    if (formato == FORMATO_CSV) {
+        printf("%s,%lld,%s,%d,%.9f,%.9f,%.9f,%.9f\n", algoritmo, n, clase, m->repeticiones,
+               m->minimo, m->mediana, m->p99, m->promedio);
+    } else if (formato == FORMATO_JSON) {
+        printf("{\"algoritmo\": \"%s\", \"n\": %lld, \"clase\": \"%s\", \"repeticiones\": %d, "
+               "\"min_s\": %.9f, \"mediana_s\": %.9f, \"p99_s\": %.9f, \"promedio_s\": %.9f}\n",
+               algoritmo, n, clase, m->repeticiones, m->minimo, m->mediana, m->p99, m->promedio);
+    }
+}
+
+#endif
@@ -1,6 +1,13 @@
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdbool.h>
+#include "../Comun/lecturaEnteros.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
+#include "ordenamientos.h"
 
 /* 
 Práctica 01 - Analisis y Diseño de Algoritmos
@@ -35,9 +42,47 @@ Ejecucion: gcc "01randomTiempo" -o randomTiempo
            ./randomTiempo {numero} < numeros.txt > salida.txt
 Ejemplo:
            ./randomTiempo.exe 100 < ./MaterialExtra/Ordenados/numeros1millon.txt > numerosInversos1millon.txt
-*/
 
-void ordenSeleccion(int *ArregloDES, int n); // Prototipo de la función ordenSeleccion
+Opciones:
+           --algoritmo {nombre}      Motor de ordenamiento: seleccion (por defecto), inverso, insercion,
+                                     introsort, radix, hibrido, adaptativo o adaptativo-inverso
+                                     (ver ordenamientos.h)
+           --entrada {archivo}       Lee los datos de un archivo de texto o de un archivo binario ".i32"
+                                     en lugar de la entrada estandar
+           --guardar-i32 {archivo}   Guarda los n enteros leidos en formato binario ".i32" para que las
+                                     siguientes corridas no tengan que convertir texto
+           --repeticiones {r}        Corridas medidas (por defecto 1); cada una ordena una copia de los datos
+           --calentamiento {w}       Corridas previas sin medir (por defecto 0)
+           --formato {f}             texto (por defecto), csv o json; csv y json emiten una fila con
+                                     minimo, mediana, p99 y promedio
+           --clase {nombre}          Clase de entrada que se reporta en csv/json (aleatorios, ordenados,
+                                     inversos, casiOrdenados...)
+
+Datos generados en memoria (sin archivo de entrada; ver Comun/generador.h):
+           --generar {clase}         aleatorios, ordenados, inversos o casiOrdenados
+           --semilla {s}             Semilla del generador (por defecto 1); misma semilla, mismos datos
+           --desplazados {k}         Posiciones revueltas en casiOrdenados (por defecto 10, como desOrdenPy)
+           Si no se indica --clase, se reporta la clase generada.
+
+Modo barrido (un solo proceso para todos los tamaños, en lugar de un proceso por n como en los .bat de Scripts):
+           --desde {a} --hasta {b} --paso {c}   Tamaños a, a+c, a+2c, ... hasta b (sin --desde, a = c;
+                                                sin --paso, c = 1 y a = b)
+           --tamanios {n1,n2,...}               Lista explícita de tamaños
+           En este modo {numero} se omite; se leen una sola vez los max(n) primeros enteros y cada
+           tamaño ordena una copia del prefijo de ese tamaño. --algoritmo acepta una lista separada
+           por comas y los resultados se emiten conforme se obtienen.
+Ejemplo:
+           ./randomTiempo 1000000 --entrada Numeros1000000.txt --guardar-i32 Numeros1000000.i32
+           ./randomTiempo 1000000 --entrada Numeros1000000.i32
+           ./randomTiempo 1000000 --algoritmo radix < Numeros1000000.txt
+           ./randomTiempo 100000 --algoritmo introsort --repeticiones 11 --formato csv --clase aleatorios < Numeros1000000.txt
+           ./randomTiempo 100000000 --algoritmo radix --generar aleatorios --semilla 7 --formato csv
+           ./randomTiempo --tamanios 100,500,1500,5000,10000,15000,50000,100000,250000,500000,1000000
+                          --algoritmo introsort,radix,adaptativo --formato csv --clase aleatorios < Numeros1000000.txt
+
+El tiempo de lectura se reporta por separado y ya no se suma al tiempo del ordenamiento.
+Los tiempos se miden con el reloj monotonico de Comun/medicion.h en lugar de clock().
+*/
 
 /*
 void generaAle(int *arr, int min, int max)
@@ -72,61 +117,34 @@ void take_enter() {
    }
 }
 
+// Datos de una corrida de ordenamiento para la medición
+typedef struct {
+    FuncionOrden ordenar;
+    const int *original;   // Datos tal como se leyeron
+    int *arreglo;          // Copia que se ordena en cada repetición
+    int n;
+} CorridaOrden;
+
 /*
-void ordenSeleccion(int *arregloDes, int n)
-Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+void prepararCorrida(void *datos)
+Recibe: void *datos (CorridaOrden)
 Devuelve: void (No retorna valor explícito)
-Observaciones: Función que ordena el arregloDes de menor a mayor haciendo uso del algoritmo de ordenamiento 
-Selección (busca el mínimo en la parte desordenada y lo intercambia con el primer elemento de esa parte además de dividir en parte ordenada y no ordenada).
+Observaciones: Restaura el arreglo desordenado antes de cada repetición; no forma parte del tiempo medido.
 */
-void ordenSeleccion(int *arregloDes, int n) {
-   // Iterar sobre el arreglo partiendo del segundo elemento¿?
-   for(int k = 0; k <= (n - 2); k++){
-       // Indice del menos valor en la parte ordenada, inicia tomando el primer elemento de la parte desordenada
-       int posMin = k;
-       // Iteracion para encontrar el minimo en la parte desordenada
-       for(int i = k + 1; i <= (n - 1); i++){
-           if(arregloDes[i] < arregloDes[posMin]){
-               // Asignar el nuevo valor minimo
-               posMin = i;
-           }
-       }
-       // Intercambiar el valor minimo con el primer elemento de la parte desordenada
-       int temp = arregloDes[posMin]; // Asigna el valor minimo a una variable temporal
-       arregloDes[posMin] = arregloDes[k]; // Reemplaza el menor valor encontrado por el primer elemento de la parte desordenada
-       arregloDes[k] = temp; // Coloca el menor valor en la posición k (moviendolo a la parte ordenada)
-   }
+void prepararCorrida(void *datos) {
+    CorridaOrden *corrida = (CorridaOrden *)datos;
+    memcpy(corrida->arreglo, corrida->original, corrida->n * sizeof(int));
 }
 
-
 /*
-void ordenInverso(int *arregloDes, int n)
-Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+void ejecutarCorrida(void *datos)
+Recibe: void *datos (CorridaOrden)
 Devuelve: void (No retorna valor explícito)
-Observaciones: Función que ordena el arregloDes de mayor a menor haciendo uso del algoritmo de ordenamiento 
-por Selección (busca el máximo en la parte desordenada y lo intercambia con el primer elemento de esa parte 
-además de dividir en parte ordenada y no ordenada).
+Observaciones: Lo que se mide: una llamada al algoritmo de ordenamiento elegido.
 */
-void ordenInverso(int *arregloDes, int n){
-    // Iterar sobre el arreglo hasta el penúltimo elemento
-    for(int k = 0; k <= (n - 2); k++){
-        // Índice del mayor valor en la parte desordenada, inicia tomando el primer elemento de la parte desordenada
-        int posMin = k;  // Nota: mantiene el nombre posMin por consistencia con el código original
-        
-        // Iteración para encontrar el máximo en la parte desordenada
-        for(int i = k + 1; i <= (n - 1); i++){
-            // Si encontramos un elemento mayor que el actual máximo
-            if(arregloDes[i] > arregloDes[posMin]){
-                // Asignar el nuevo valor máximo
-                posMin = i;
-            }
-        }
-        
-        // Intercambiar el valor máximo con el primer elemento de la parte desordenada
-        int temp = arregloDes[posMin]; // Asigna el valor máximo a una variable temporal
-        arregloDes[posMin] = arregloDes[k]; // Reemplaza el mayor valor encontrado por el primer elemento de la parte desordenada
-        arregloDes[k] = temp; // Coloca el mayor valor en la posición k (moviéndolo a la parte ordenada)
-    }
+void ejecutarCorrida(void *datos) {
+    CorridaOrden *corrida = (CorridaOrden *)datos;
+    corrida->ordenar(corrida->arreglo, corrida->n);
 }
 
 /*
@@ -134,67 +152,269 @@ int main(int num_arg, char *arg_user[])
 Recibe: int num_arg (número de argumentos de línea de comandos), char *arg_user[] (arreglo de argumentos)
 Devuelve: int (código de salida del programa, 0 indica ejecución exitosa)
 Observaciones: Función principal que ejecuta el programa de ordenamiento por selección.
-Valida argumentos, asigna memoria dinámicamente, lee datos de entrada estándar, 
-ejecuta el algoritmo de ordenamiento y mide el tiempo de ejecución utilizando clock().
+Valida argumentos, asigna memoria dinámicamente, lee los datos de entrada (entrada estándar o archivo),
+ejecuta el algoritmo de ordenamiento y mide por separado el tiempo de lectura y el de ordenamiento
+utilizando el reloj monotonico de Comun/medicion.h.
 */
 int main(int num_arg, char *arg_user[]) {
-   // Calculamos el tiempo que toma ejecutar  take_enter()
-   clock_t t;
-   t = clock();
+   double t;
 
-   //Recibir por argumento el tamaño de n y el valor / intervalo de valores a usar
-	if (num_arg != 2) {
-		printf("Indique el tamanio de n y el valor \n",arg_user[0]);
+   //Recibir por argumento el tamaño de n y, opcionalmente, el archivo de entrada
+	if (num_arg < 2) {
+		printf("Uso: %s {numero} [--algoritmo nombre] [--entrada archivo] [--guardar-i32 archivo.i32]\n"
+		       "       [--repeticiones r] [--calentamiento w] [--formato texto|csv|json] [--clase nombre]\n"
+		       "       %s (--desde a --hasta b --paso c | --tamanios n1,n2,...) [--algoritmo a1,a2,...] [...]\n",
+		       arg_user[0], arg_user[0]);
 		exit(1);
 	} 
 
-   // Variable que define el numero de elementos
-   int n = atoi(arg_user[1]);
+   // Variable que define el numero de elementos (se omite en modo barrido)
+   int n = 0;
+   int primeraOpcion = 1;
+   if (strncmp(arg_user[1], "--", 2) != 0) {
+       n = atoi(arg_user[1]);
+       primeraOpcion = 2;
+   }
+
+   // Opciones de lectura
+   const char *rutaEntrada = NULL;   // NULL indica entrada estandar
+   const char *rutaBinario = NULL;   // Cache ".i32" a generar
+   const char *listaAlgoritmos = "seleccion";
+   // Opciones de medicion
+   int repeticiones = 1, calentamiento = 0;
+   FormatoMedicion formato = FORMATO_TEXTO;
+   const char *clase = NULL;
+   // Opciones del generador
+   bool generar = false;
+   ClaseEntrada claseGenerada = CLASE_ALEATORIOS;
+   unsigned long long semilla = 1;
+   long long desplazados = DESPLAZADOS_POR_DEFECTO;
+   // Opciones de barrido
+   int desde = 0, hasta = 0, paso = 0;
+   const char *listaTamanios = NULL;
+   for (int i = primeraOpcion; i < num_arg; i++) {
+       if (strcmp(arg_user[i], "--algoritmo") == 0 && i + 1 < num_arg) {
+           listaAlgoritmos = arg_user[++i];
+       } else if (strcmp(arg_user[i], "--entrada") == 0 && i + 1 < num_arg) {
+           rutaEntrada = arg_user[++i];
+       } else if (strcmp(arg_user[i], "--guardar-i32") == 0 && i + 1 < num_arg) {
+           rutaBinario = arg_user[++i];
+       } else if (strcmp(arg_user[i], "--repeticiones") == 0 && i + 1 < num_arg) {
+           repeticiones = atoi(arg_user[++i]);
+       } else if (strcmp(arg_user[i], "--calentamiento") == 0 && i + 1 < num_arg) {
+           calentamiento = atoi(arg_user[++i]);
+       } else if (strcmp(arg_user[i], "--formato") == 0 && i + 1 < num_arg && formatoDesdeTexto(arg_user[i + 1], &formato)) {
+           i++;
+       } else if (strcmp(arg_user[i], "--clase") == 0 && i + 1 < num_arg) {
+           clase = arg_user[++i];
+       } else if (strcmp(arg_user[i], "--generar") == 0 && i + 1 < num_arg && claseDesdeTexto(arg_user[i + 1], &claseGenerada)) {
+           generar = true;
+           i++;
+       } else if (strcmp(arg_user[i], "--semilla") == 0 && i + 1 < num_arg) {
+           semilla = strtoull(arg_user[++i], NULL, 10);
+       } else if (strcmp(arg_user[i], "--desplazados") == 0 && i + 1 < num_arg) {
+           desplazados = atoll(arg_user[++i]);
+       } else if (strcmp(arg_user[i], "--desde") == 0 && i + 1 < num_arg) {
+           desde = atoi(arg_user[++i]);
+       } else if (strcmp(arg_user[i], "--hasta") == 0 && i + 1 < num_arg) {
+           hasta = atoi(arg_user[++i]);
+       } else if (strcmp(arg_user[i], "--paso") == 0 && i + 1 < num_arg) {
+           paso = atoi(arg_user[++i]);
+       } else if (strcmp(arg_user[i], "--tamanios") == 0 && i + 1 < num_arg) {
+           listaTamanios = arg_user[++i];
+       } else {
+           printf("Opcion no reconocida: %s\n", arg_user[i]);
+           exit(1);
+       }
+   }
+   if (clase == NULL) {
+       clase = generar ? NOMBRES_CLASE_ENTRADA[claseGenerada] : "sin_clase";
+   }
+
+   // Tamaños a medir: el n de siempre, una lista explícita o el rango desde..hasta
+   int numTamanios = 0;
+   int *tamanios = NULL;
+   if (listaTamanios != NULL) {
+       // Una coma separa dos tamaños: la lista trae a lo más comas + 1
+       size_t comas = 0;
+       for (const char *p = listaTamanios; *p != '\0'; p++) {
+           comas += (*p == ',');
+       }
+       tamanios = malloc((comas + 1) * sizeof(int));
+       for (const char *p = listaTamanios; tamanios != NULL && *p != '\0'; ) {
+           size_t lon = strcspn(p, ",");
+           char *fin;
+           long valor = strtol(p, &fin, 10);
+           if (lon == 0 || fin != p + lon || valor <= 0 || valor > INT_MAX) {
+               printf("Error: tamaño no válido en --tamanios: \"%.*s\"\n", (int)lon, p);
+               exit(1);
+           }
+           tamanios[numTamanios++] = (int)valor;
+           p += lon;
+           p += (*p == ',');
+       }
+   } else if (hasta > 0) {
+       // Mismas reglas que complejidadT de la Practica 02
+       if (desde <= 0) desde = paso > 0 ? paso : hasta;
+       if (paso <= 0) paso = 1;
+       if (desde > hasta) {
+           printf("Error: --desde (%d) debe ser menor o igual que --hasta (%d)\n", desde, hasta);
+           exit(1);
+       }
+       // Se cuentan los tamaños antes de recorrerlos: desde + k * paso nunca pasa de hasta
+       int cuenta = (hasta - desde) / paso + 1;
+       tamanios = malloc(cuenta * sizeof(int));
+       for (int k = 0; tamanios != NULL && k < cuenta; k++) {
+           tamanios[numTamanios++] = desde + k * paso;
+       }
+   } else {
+       tamanios = malloc(sizeof(int));
+       if (tamanios != NULL) tamanios[numTamanios++] = n;
+   }
+   if (tamanios == NULL) {
+       printf("Error: No se pudo asignar memoria\n");
+       exit(1);
+   }
+   int maxN = 0;
+   for (int i = 0; i < numTamanios; i++) {
+       if (tamanios[i] <= 0) {
+           printf("Error: los tamaños deben ser positivos\n");
+           exit(1);
+       }
+       if (tamanios[i] > maxN) maxN = tamanios[i];
+   }
+
+   // Validar todos los algoritmos antes de leer los datos
+   char nombreAlgoritmo[64];
+   for (const char *p = listaAlgoritmos; *p != '\0'; ) {
+       size_t lon = strcspn(p, ",");
+       snprintf(nombreAlgoritmo, sizeof(nombreAlgoritmo), "%.*s", (int)lon, p);
+       if (buscarMotorOrden(nombreAlgoritmo) == NULL) {
+           printf("Algoritmo desconocido: %s\nDisponibles:", nombreAlgoritmo);
+           for (int i = 0; i < NUM_MOTORES_ORDEN; i++) {
+               printf(" %s", MOTORES_ORDEN[i].nombre);
+           }
+           printf("\n");
+           exit(1);
+       }
+       p += lon;
+       p += (*p == ',');
+   }
 
-   // Apartar memoria para n números enteros
-   int *arreglo = malloc(n * sizeof(int));
+   // Apartar memoria para maxN números enteros: los datos leidos y la copia que se ordena
+   int *original = malloc(maxN * sizeof(int));
+   int *arreglo = malloc(maxN * sizeof(int));
 
    // Validar que se haya apartado la memoria correctamente
-    if (arreglo == NULL) {
+    if (original == NULL || arreglo == NULL) {
         printf("Error: No se pudo asignar memoria\n");
         exit(1);
     }
     
-    //Lee de la entrada estandar los n valores y los coloca en un arreglo
-    for (int i = 0; i < n; i++) {
-        scanf("%d", &arreglo[i]);
+    //Lee los valores una sola vez, en bloque, y los coloca en un arreglo (o los genera en memoria)
+    t = tiempoMonotonico();
+    long long leidos;
+    if (generar) {
+        if (!generarEnteros(original, maxN, claseGenerada, semilla, desplazados)) {
+            printf("Error: No se pudo asignar memoria\n");
+            exit(1);
+        }
+        leidos = maxN;
+    } else {
+        leidos = cargarEnteros(rutaEntrada, original, maxN);
+    }
+    t = tiempoMonotonico() - t;
+    if (leidos < 0) {
+        printf("Error: No se pudo abrir %s\n", rutaEntrada);
+        exit(1);
+    }
+    if (leidos < maxN) {
+        printf("Error: Solo se leyeron %lld de %d enteros\n", leidos, maxN);
+        exit(1);
+    }
+    // En csv/json la salida estandar queda solo para las filas de resultados
+    FILE *informe = (formato == FORMATO_TEXTO) ? stdout : stderr;
+    fprintf(informe, "%s de datos: %f segundos\n", generar ? "Generacion" : "Lectura", t);
+
+    if (rutaBinario != NULL && !guardarEnterosBinario(rutaBinario, original, maxN)) {
+        printf("Error: No se pudo escribir %s\n", rutaBinario);
+        exit(1);
     }
 
     // Mostrar el arreglo antes del ordenamiento
     //printf("Arreglo antes del ordenamiento: \n");
     //for (int i = 0; i < n; i++) {
-      //  printf("%d \n", arreglo[i]);
+      //  printf("%d \n", original[i]);
     //}
     //printf("\n");
 
+   Medicion medicion;
+   if (!medicionCrear(&medicion, calentamiento, repeticiones)) {
+       printf("Error: No se pudo asignar memoria\n");
+       exit(1);
+   }
+   bool barrido = numTamanios > 1 || strchr(listaAlgoritmos, ',') != NULL;
+   imprimirEncabezadoMedicion(formato);
+
+   for (int k = 0; k < numTamanios; k++) {
+       // El prefijo de tamaños[k] elementos hace el papel del archivo de ese tamaño, salvo con
+       // --generar casiOrdenados: el prefijo no conserva los k desplazados, así que se genera cada
+       // tamaño una vez y todos los algoritmos ordenan copias de esa misma entrada
+       if (generar && claseGenerada == CLASE_CASI_ORDENADOS && numTamanios > 1 &&
+           !generarEnteros(original, tamanios[k], claseGenerada, semilla, desplazados)) {
+           printf("Error: No se pudo asignar memoria\n");
+           exit(1);
+       }
+       for (const char *p = listaAlgoritmos; *p != '\0'; ) {
+           size_t lon = strcspn(p, ",");
+           snprintf(nombreAlgoritmo, sizeof(nombreAlgoritmo), "%.*s", (int)lon, p);
+           p += lon;
+           p += (*p == ',');
 
-   printf("Inicia timer\n");
-   //generaAle(arreglo,0,n);
+           CorridaOrden corrida = {buscarMotorOrden(nombreAlgoritmo), original, arreglo, tamanios[k]};
 
-    //*****************************************  
-	// Algoritmo de Ordenamiento Seleccion
-	//*****************************************
-    // Llamar a la función de ordenamiento
-    ordenSeleccion(arreglo,n);
-    //ordenInverso(arreglo,n);
-   
-   // Mostrar el arreglo ordenado
-   //printf("\nArreglo despues del ordenamiento: \n");
-   //for (int i = 0; i < n; i++) {
-       //printf("%d \n", arreglo[i]);
-   //}
-   //printf("Se detuvo el timer\n");
-   t = clock() - t;
-   double time_taken = ((double)t)/CLOCKS_PER_SEC; // calculamos el tiempo trascurrido
-   printf("Le tomo %f segundos ejecutarse", time_taken);
+           if (barrido) {
+               fprintf(informe, "\nAlgoritmo: %s, n = %d\n", nombreAlgoritmo, tamanios[k]);
+           } else {
+               fprintf(informe, "Algoritmo: %s\n", nombreAlgoritmo);
+           }
+           fprintf(informe, "Inicia timer\n");
+           //generaAle(arreglo,0,n);
+
+            //*****************************************  
+            // Algoritmo de Ordenamiento (Seleccion por defecto)
+            //*****************************************
+            // Llamar a la función de ordenamiento elegida con --algoritmo, una vez por repeticion
+            medir(&medicion, prepararCorrida, ejecutarCorrida, &corrida);
+           
+           // Mostrar el arreglo ordenado
+           //printf("\nArreglo despues del ordenamiento: \n");
+           //for (int i = 0; i < n; i++) {
+               //printf("%d \n", arreglo[i]);
+           //}
+           //printf("Se detuvo el timer\n");
+           if (formato == FORMATO_TEXTO) {
+               double time_taken = medicion.mediana; // con una sola repeticion es el tiempo de esa corrida
+               printf("Le tomo %f segundos ejecutarse", time_taken);
+               if (medicion.repeticiones > 1) {
+                   printf(" (mediana de %d; minimo %f, p99 %f)", medicion.repeticiones, medicion.minimo, medicion.p99);
+               }
+               if (barrido) {
+                   printf("\n");
+               }
+           } else {
+               imprimirMedicion(formato, nombreAlgoritmo, tamanios[k], clase, &medicion);
+           }
+           // Emitir cada resultado en cuanto se obtiene
+           fflush(stdout);
+       }
+   }
    
    // Liberar la memoria asignada dinámicamente
+   medicionLiberar(&medicion);
+   free(tamanios);
+   free(original);
    free(arreglo);
    
    return 0;
-}
\ No newline at end of file
+}
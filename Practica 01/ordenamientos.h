@@ -0,0 +1,614 @@
+#ifndef ORDENAMIENTOS_H
+#define ORDENAMIENTOS_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "seleccionVectorial.h"
+
+/*
+Práctica 01 - Biblioteca de ordenamientos
+
+Todos los algoritmos comparten la firma de ordenSeleccion, void (int *arreglo, int n),
+para poder intercambiarse desde la linea de comandos (--algoritmo) sin tocar el resto
+del programa. El ordenamiento por Selección se conserva como linea base para comparar.
+
+Motores disponibles:
+ seleccion   Selección, O(n²) (linea base de la práctica)
+ inverso     Selección de mayor a menor, O(n²)
+ seleccion-simd, inverso-simd
+             Los mismos dos, buscando el mínimo (máximo) con AVX2/SSE4.1 según el procesador
+             (ver seleccionVectorial.h); mismos intercambios, varias veces más rápidos
+ seleccion-doble
+             Selección que coloca el mínimo y el máximo en cada pasada: n/2 pasadas, O(n²)
+ insercion   Inserción, O(n²) pero O(n) con datos ordenados
+ introsort   Quicksort con mediana de tres que cambia a Heapsort si la recursión se
+             degenera y termina con Inserción en particiones pequeñas, O(n log n)
+ radix       Radix sort LSD de 4 pasadas de 8 bits para enteros de 32 bits, O(n)
+ hibrido     Merge sort que ordena por Inserción los tramos de hasta
+             UMBRAL_INSERCION elementos, O(n log n) y estable
+ adaptativo  Detecta corridas naturales y las mezcla (estilo TimSort): O(n) con datos
+             ordenados o inversos, casi O(n) con datos casi ordenados, O(n log n) en general
+ adaptativo-inverso
+             Igual que adaptativo pero deja el arreglo de mayor a menor, como ordenInverso
+*/
+
+// Tamaño por debajo del cual los motores recursivos cambian a Inserción
+#define UMBRAL_INSERCION 24
+
+typedef void (*FuncionOrden)(int *arreglo, int n);
+
+/*
+void ordenSeleccion(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Función que ordena el arregloDes de menor a mayor haciendo uso del algoritmo de ordenamiento 
+Selección (busca el mínimo en la parte desordenada y lo intercambia con el primer elemento de esa parte además de dividir en parte ordenada y no ordenada).
+*/
+static inline void ordenSeleccion(int *arregloDes, int n) {
+   // Iterar sobre el arreglo partiendo del segundo elemento¿?
+   for(int k = 0; k <= (n - 2); k++){
+       // Indice del menos valor en la parte ordenada, inicia tomando el primer elemento de la parte desordenada
+       int posMin = k;
+       // Iteracion para encontrar el minimo en la parte desordenada
+       for(int i = k + 1; i <= (n - 1); i++){
+           if(arregloDes[i] < arregloDes[posMin]){
+               // Asignar el nuevo valor minimo
+               posMin = i;
+           }
+       }
+       // Intercambiar el valor minimo con el primer elemento de la parte desordenada
+       int temp = arregloDes[posMin]; // Asigna el valor minimo a una variable temporal
+       arregloDes[posMin] = arregloDes[k]; // Reemplaza el menor valor encontrado por el primer elemento de la parte desordenada
+       arregloDes[k] = temp; // Coloca el menor valor en la posición k (moviendolo a la parte ordenada)
+   }
+}
+
+
+/*
+void ordenInverso(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Función que ordena el arregloDes de mayor a menor haciendo uso del algoritmo de ordenamiento 
+por Selección (busca el máximo en la parte desordenada y lo intercambia con el primer elemento de esa parte 
+además de dividir en parte ordenada y no ordenada).
+*/
+static inline void ordenInverso(int *arregloDes, int n){
+    // Iterar sobre el arreglo hasta el penúltimo elemento
+    for(int k = 0; k <= (n - 2); k++){
+        // Índice del mayor valor en la parte desordenada, inicia tomando el primer elemento de la parte desordenada
+        int posMin = k;  // Nota: mantiene el nombre posMin por consistencia con el código original
+        
+        // Iteración para encontrar el máximo en la parte desordenada
+        for(int i = k + 1; i <= (n - 1); i++){
+            // Si encontramos un elemento mayor que el actual máximo
+            if(arregloDes[i] > arregloDes[posMin]){
+                // Asignar el nuevo valor máximo
+                posMin = i;
+            }
+        }
+        
+        // Intercambiar el valor máximo con el primer elemento de la parte desordenada
+        int temp = arregloDes[posMin]; // Asigna el valor máximo a una variable temporal
+        arregloDes[posMin] = arregloDes[k]; // Reemplaza el mayor valor encontrado por el primer elemento de la parte desordenada
+        arregloDes[k] = temp; // Coloca el mayor valor en la posición k (moviéndolo a la parte ordenada)
+    }
+}
+
+
+/*
+void ordenInsercion(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Ordena de menor a mayor recorriendo cada elemento hacia la izquierda hasta su
+posición dentro de la parte ya ordenada. Es la base de los motores recursivos para tramos pequeños.
+*/
+static inline void ordenInsercion(int *arregloDes, int n) {
+    for (int k = 1; k < n; k++) {
+        int valor = arregloDes[k];
+        int i = k - 1;
+        // Recorrer a la derecha los elementos mayores que valor
+        while (i >= 0 && arregloDes[i] > valor) {
+            arregloDes[i + 1] = arregloDes[i];
+            i--;
+        }
+        arregloDes[i + 1] = valor;
+    }
+}
+
+/*
+void hundirMonticulo(int *arregloDes, int i, int n)
+Recibe: int * arreglo (puntero) como arregloDes, i como nodo a acomodar y n como tamaño del montículo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Baja el nodo i hasta que sea mayor o igual que sus hijos (montículo de máximos).
+*/
+static inline void hundirMonticulo(int *arregloDes, int i, int n) {
+    int valor = arregloDes[i];
+    int hijo;
+    while ((hijo = 2 * i + 1) < n) {
+        if (hijo + 1 < n && arregloDes[hijo + 1] > arregloDes[hijo]) {
+            hijo++;
+        }
+        if (arregloDes[hijo] <= valor) {
+            break;
+        }
+        arregloDes[i] = arregloDes[hijo];
+        i = hijo;
+    }
+    arregloDes[i] = valor;
+}
+
+/*
+void ordenMonticulo(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Heapsort, O(n log n) en el peor caso. Introsort lo usa cuando la recursión del
+Quicksort rebasa su límite de profundidad.
+*/
+static inline void ordenMonticulo(int *arregloDes, int n) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        hundirMonticulo(arregloDes, i, n);
+    }
+    for (int fin = n - 1; fin > 0; fin--) {
+        int temp = arregloDes[0];
+        arregloDes[0] = arregloDes[fin];
+        arregloDes[fin] = temp;
+        hundirMonticulo(arregloDes, 0, fin);
+    }
+}
+
+/*
+void introsortRec(int *arregloDes, int n, int profundidad)
+Recibe: int * arreglo (puntero) como arregloDes, n como tamaño del tramo y profundidad como
+        número de particiones que aún se permiten antes de cambiar a Heapsort
+Devuelve: void (No retorna valor explícito)
+Observaciones: Deja sin ordenar los tramos menores a UMBRAL_INSERCION; ordenIntrosort los termina
+con una sola pasada de Inserción sobre todo el arreglo.
+*/
+static inline void introsortRec(int *arregloDes, int n, int profundidad) {
+    while (n > UMBRAL_INSERCION) {
+        if (profundidad == 0) {
+            ordenMonticulo(arregloDes, n);
+            return;
+        }
+        profundidad--;
+
+        // Mediana de tres como pivote, evita el peor caso con datos ordenados e inversos
+        int a = arregloDes[0], b = arregloDes[n / 2], c = arregloDes[n - 1];
+        int pivote = (a < b) ? ((b < c) ? b : ((a < c) ? c : a))
+                             : ((a < c) ? a : ((b < c) ? c : b));
+
+        // Partición de Hoare
+        int i = -1, j = n;
+        for (;;) {
+            do { i++; } while (arregloDes[i] < pivote);
+            do { j--; } while (arregloDes[j] > pivote);
+            if (i >= j) {
+                break;
+            }
+            int temp = arregloDes[i];
+            arregloDes[i] = arregloDes[j];
+            arregloDes[j] = temp;
+        }
+
+        // Recursión sobre la parte menor y ciclo sobre la mayor para acotar la pila
+        int izq = j + 1;
+        if (izq < n - izq) {
+            introsortRec(arregloDes, izq, profundidad);
+            arregloDes += izq;
+            n -= izq;
+        } else {
+            introsortRec(arregloDes + izq, n - izq, profundidad);
+            n = izq;
+        }
+    }
+}
+
+/*
+void ordenIntrosort(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Introsort con límite de profundidad 2*log2(n), O(n log n) en el peor caso.
+*/
+static inline void ordenIntrosort(int *arregloDes, int n) {
+    int profundidad = 0;
+    for (int m = n; m > 1; m >>= 1) {
+        profundidad += 2;
+    }
+    introsortRec(arregloDes, n, profundidad);
+    ordenInsercion(arregloDes, n);
+}
+
+/*
+void ordenRadix(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Radix sort LSD en 4 pasadas de 8 bits. Se invierte el bit de signo para que los
+negativos queden antes que los positivos. Las pasadas en las que todos los elementos comparten el
+mismo byte se omiten. Si no hay memoria para el arreglo auxiliar se usa Introsort.
+*/
+static inline void ordenRadix(int *arregloDes, int n) {
+    if (n < 2) {
+        return;
+    }
+    unsigned int *origen = (unsigned int *)arregloDes;
+    unsigned int *auxiliar = malloc((size_t)n * sizeof(unsigned int));
+    if (auxiliar == NULL) {
+        ordenIntrosort(arregloDes, n);
+        return;
+    }
+
+    // Histogramas de las 4 pasadas en un solo recorrido
+    size_t conteo[4][256];
+    memset(conteo, 0, sizeof(conteo));
+    for (int i = 0; i < n; i++) {
+        unsigned int clave = origen[i] ^ 0x80000000u;
+        conteo[0][clave & 0xFF]++;
+        conteo[1][(clave >> 8) & 0xFF]++;
+        conteo[2][(clave >> 16) & 0xFF]++;
+        conteo[3][clave >> 24]++;
+    }
+
+    unsigned int *destino = auxiliar;
+    for (int pasada = 0; pasada < 4; pasada++) {
+        int desplazamiento = pasada * 8;
+        unsigned int primerByte = ((origen[0] ^ 0x80000000u) >> desplazamiento) & 0xFF;
+        if (conteo[pasada][primerByte] == (size_t)n) {
+            continue;  // Todos comparten este byte, la pasada no cambiaria nada
+        }
+
+        // Convertir el histograma en posiciones de inicio
+        size_t posicion = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t cantidad = conteo[pasada][b];
+            conteo[pasada][b] = posicion;
+            posicion += cantidad;
+        }
+        for (int i = 0; i < n; i++) {
+            unsigned int b = ((origen[i] ^ 0x80000000u) >> desplazamiento) & 0xFF;
+            destino[conteo[pasada][b]++] = origen[i];
+        }
+
+        unsigned int *temp = origen;
+        origen = destino;
+        destino = temp;
+    }
+
+    if (origen != (unsigned int *)arregloDes) {
+        memcpy(arregloDes, origen, (size_t)n * sizeof(int));
+    }
+    free(auxiliar);
+}
+
+/*
+void hibridoRec(int *arregloDes, int *auxiliar, int n)
+Recibe: int * arreglo (puntero) como arregloDes, auxiliar con espacio para n enteros y n como tamaño del tramo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Merge sort que cambia a Inserción en tramos pequeños. Si las dos mitades ya están en
+orden se omite la mezcla.
+*/
+static inline void hibridoRec(int *arregloDes, int *auxiliar, int n) {
+    if (n <= UMBRAL_INSERCION) {
+        ordenInsercion(arregloDes, n);
+        return;
+    }
+    int mitad = n / 2;
+    hibridoRec(arregloDes, auxiliar, mitad);
+    hibridoRec(arregloDes + mitad, auxiliar, n - mitad);
+    if (arregloDes[mitad - 1] <= arregloDes[mitad]) {
+        return;
+    }
+
+    // Solo se copia la mitad izquierda; la derecha se mezcla en su lugar
+    memcpy(auxiliar, arregloDes, (size_t)mitad * sizeof(int));
+    int i = 0, j = mitad, k = 0;
+    while (i < mitad && j < n) {
+        if (arregloDes[j] < auxiliar[i]) {
+            arregloDes[k++] = arregloDes[j++];
+        } else {
+            arregloDes[k++] = auxiliar[i++];
+        }
+    }
+    while (i < mitad) {
+        arregloDes[k++] = auxiliar[i++];
+    }
+}
+
+/*
+void ordenHibrido(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Merge sort con corte a Inserción, estable. Necesita un auxiliar de n/2 enteros;
+si no hay memoria se usa Introsort.
+*/
+static inline void ordenHibrido(int *arregloDes, int n) {
+    if (n <= UMBRAL_INSERCION) {
+        ordenInsercion(arregloDes, n);
+        return;
+    }
+    int *auxiliar = malloc((size_t)(n / 2) * sizeof(int));
+    if (auxiliar == NULL) {
+        ordenIntrosort(arregloDes, n);
+        return;
+    }
+    hibridoRec(arregloDes, auxiliar, n);
+    free(auxiliar);
+}
+
+/*
+int longitudCorridaMinima(int n)
+Recibe: n como tamaño del arreglo
+Devuelve: int (longitud mínima de corrida, entre 16 y 32)
+Observaciones: Igual que en TimSort, se escoge para que n / corridaMinima sea una potencia de 2 o
+un poco menos, de forma que las mezclas queden balanceadas.
+*/
+static inline int longitudCorridaMinima(int n) {
+    int resto = 0;
+    while (n >= 32) {
+        resto |= n & 1;
+        n >>= 1;
+    }
+    return n + resto;
+}
+
+/*
+int busquedaSuperior(const int *arreglo, int n, int valor)
+Recibe: arreglo ordenado de tamaño n y el valor a ubicar
+Devuelve: int (primer índice cuyo elemento es mayor que valor)
+Observaciones: Búsqueda binaria usada para recortar las mezclas de corridas.
+*/
+static inline int busquedaSuperior(const int *arreglo, int n, int valor) {
+    int ini = 0, fin = n;
+    while (ini < fin) {
+        int mitad = ini + (fin - ini) / 2;
+        if (arreglo[mitad] <= valor) {
+            ini = mitad + 1;
+        } else {
+            fin = mitad;
+        }
+    }
+    return ini;
+}
+
+/*
+int busquedaInferior(const int *arreglo, int n, int valor)
+Recibe: arreglo ordenado de tamaño n y el valor a ubicar
+Devuelve: int (primer índice cuyo elemento es mayor o igual que valor)
+Observaciones: Búsqueda binaria usada para recortar las mezclas de corridas.
+*/
+static inline int busquedaInferior(const int *arreglo, int n, int valor) {
+    int ini = 0, fin = n;
+    while (ini < fin) {
+        int mitad = ini + (fin - ini) / 2;
+        if (arreglo[mitad] < valor) {
+            ini = mitad + 1;
+        } else {
+            fin = mitad;
+        }
+    }
+    return ini;
+}
+
+/*
+int extenderCorrida(int *arregloDes, int inicio, int n)
+Recibe: int * arreglo (puntero) como arregloDes, inicio de la corrida y n como tamaño del arreglo
+Devuelve: int (longitud de la corrida natural que empieza en inicio)
+Observaciones: Una corrida es un tramo no decreciente o estrictamente decreciente; las decrecientes
+se invierten en su lugar. Se exige decreciente estricto para no romper la estabilidad.
+*/
+static inline int extenderCorrida(int *arregloDes, int inicio, int n) {
+    int fin = inicio + 1;
+    if (fin == n) {
+        return 1;
+    }
+    if (arregloDes[fin] < arregloDes[inicio]) {
+        while (fin + 1 < n && arregloDes[fin + 1] < arregloDes[fin]) {
+            fin++;
+        }
+        // Invertir la corrida decreciente
+        for (int i = inicio, j = fin; i < j; i++, j--) {
+            int temp = arregloDes[i];
+            arregloDes[i] = arregloDes[j];
+            arregloDes[j] = temp;
+        }
+    } else {
+        while (fin + 1 < n && arregloDes[fin + 1] >= arregloDes[fin]) {
+            fin++;
+        }
+    }
+    return fin - inicio + 1;
+}
+
+/*
+void mezclarCorridas(int *arregloDes, int lonA, int lonB, int *auxiliar)
+Recibe: int * arreglo (puntero) como arregloDes con dos corridas contiguas de longitudes lonA y lonB,
+        auxiliar con espacio para min(lonA, lonB) enteros
+Devuelve: void (No retorna valor explícito)
+Observaciones: Antes de mezclar se descartan con búsqueda binaria los elementos de A que ya están
+en su lugar al inicio y los de B que ya están al final, así que dos corridas casi en orden cuestan
+O(log n). Se copia a auxiliar la parte más corta y se mezcla hacia adelante o hacia atrás según el caso.
+*/
+static inline void mezclarCorridas(int *arregloDes, int lonA, int lonB, int *auxiliar) {
+    int *a = arregloDes;
+    int *b = arregloDes + lonA;
+
+    // Elementos de A menores o iguales que b[0] ya están en su posición final
+    int saltar = busquedaSuperior(a, lonA, b[0]);
+    a += saltar;
+    lonA -= saltar;
+    if (lonA == 0) {
+        return;
+    }
+    // Elementos de B mayores o iguales que el último de A ya están en su posición final
+    lonB = busquedaInferior(b, lonB, a[lonA - 1]);
+    if (lonB == 0) {
+        return;
+    }
+
+    if (lonA <= lonB) {
+        // Mezcla hacia adelante con A en el auxiliar
+        memcpy(auxiliar, a, (size_t)lonA * sizeof(int));
+        int i = 0, j = 0, k = 0;
+        while (i < lonA && j < lonB) {
+            if (b[j] < auxiliar[i]) {
+                a[k++] = b[j++];
+            } else {
+                a[k++] = auxiliar[i++];
+            }
+        }
+        while (i < lonA) {
+            a[k++] = auxiliar[i++];
+        }
+    } else {
+        // Mezcla hacia atrás con B en el auxiliar
+        memcpy(auxiliar, b, (size_t)lonB * sizeof(int));
+        int i = lonA - 1, j = lonB - 1, k = lonA + lonB - 1;
+        while (i >= 0 && j >= 0) {
+            if (auxiliar[j] < a[i]) {
+                a[k--] = a[i--];
+            } else {
+                a[k--] = auxiliar[j--];
+            }
+        }
+        while (j >= 0) {
+            a[k--] = auxiliar[j--];
+        }
+    }
+}
+
+/*
+void ordenAdaptativo(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Ordenamiento adaptativo al estilo de TimSort. Una pasada lineal detecta las corridas
+naturales (invirtiendo en su lugar las decrecientes), las corridas cortas se completan con Inserción
+hasta longitudCorridaMinima, y las corridas se mezclan con una pila que mantiene sus longitudes
+balanceadas. Con datos ordenados o inversos hace una sola pasada, O(n); con unos cuantos elementos
+fuera de lugar ("casi ordenados") queda cerca de O(n); en el peor caso es O(n log n) y estable.
+*/
+static inline void ordenAdaptativo(int *arregloDes, int n) {
+    if (n < 2) {
+        return;
+    }
+    int minima = longitudCorridaMinima(n);
+    int *auxiliar = malloc((size_t)(n / 2 + 1) * sizeof(int));
+    if (auxiliar == NULL) {
+        ordenIntrosort(arregloDes, n);
+        return;
+    }
+
+    // Pila de corridas pendientes; 64 niveles alcanzan porque las longitudes crecen como Fibonacci
+    int inicioCorrida[64], lonCorrida[64];
+    int tope = 0;
+
+    int inicio = 0;
+    while (inicio < n) {
+        int lon = extenderCorrida(arregloDes, inicio, n);
+        if (lon < minima) {
+            // Completar la corrida con Inserción; los primeros lon elementos ya están en orden
+            int extendida = (n - inicio < minima) ? n - inicio : minima;
+            int *tramo = arregloDes + inicio;
+            for (int k = lon; k < extendida; k++) {
+                int valor = tramo[k];
+                int pos = busquedaSuperior(tramo, k, valor);
+                memmove(tramo + pos + 1, tramo + pos, (size_t)(k - pos) * sizeof(int));
+                tramo[pos] = valor;
+            }
+            lon = extendida;
+        }
+        inicioCorrida[tope] = inicio;
+        lonCorrida[tope] = lon;
+        tope++;
+        inicio += lon;
+
+        // Restablecer las reglas de la pila: |Z| > |Y| + |X| y |Y| > |X| (X en el tope)
+        while (tope > 1) {
+            int m = tope - 2;
+            if ((m > 0 && lonCorrida[m - 1] <= lonCorrida[m] + lonCorrida[m + 1]) ||
+                (m > 1 && lonCorrida[m - 2] <= lonCorrida[m - 1] + lonCorrida[m])) {
+                if (lonCorrida[m - 1] < lonCorrida[m + 1]) {
+                    m--;
+                }
+            } else if (lonCorrida[m] > lonCorrida[m + 1]) {
+                break;
+            }
+            mezclarCorridas(arregloDes + inicioCorrida[m], lonCorrida[m], lonCorrida[m + 1], auxiliar);
+            lonCorrida[m] += lonCorrida[m + 1];
+            for (int k = m + 1; k < tope - 1; k++) {
+                inicioCorrida[k] = inicioCorrida[k + 1];
+                lonCorrida[k] = lonCorrida[k + 1];
+            }
+            tope--;
+        }
+    }
+
+    // Mezclar las corridas que quedaron en la pila, de la más reciente a la más antigua
+    while (tope > 1) {
+        int m = tope - 2;
+        if (m > 0 && lonCorrida[m - 1] < lonCorrida[m + 1]) {
+            m--;
+        }
+        mezclarCorridas(arregloDes + inicioCorrida[m], lonCorrida[m], lonCorrida[m + 1], auxiliar);
+        lonCorrida[m] += lonCorrida[m + 1];
+        for (int k = m + 1; k < tope - 1; k++) {
+            inicioCorrida[k] = inicioCorrida[k + 1];
+            lonCorrida[k] = lonCorrida[k + 1];
+        }
+        tope--;
+    }
+
+    free(auxiliar);
+}
+
+/*
+void ordenAdaptativoInverso(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Versión adaptativa de ordenInverso (de mayor a menor): ordena con ordenAdaptativo y
+voltea el resultado en O(n).
+*/
+static inline void ordenAdaptativoInverso(int *arregloDes, int n) {
+    ordenAdaptativo(arregloDes, n);
+    for (int i = 0, j = n - 1; i < j; i++, j--) {
+        int temp = arregloDes[i];
+        arregloDes[i] = arregloDes[j];
+        arregloDes[j] = temp;
+    }
+}
+
+typedef struct {
+    const char *nombre;     // Nombre usado en --algoritmo
+    FuncionOrden funcion;   // Función con la firma de ordenSeleccion
+} MotorOrden;
+
+static const MotorOrden MOTORES_ORDEN[] = {
+    {"seleccion", ordenSeleccion},
+    {"inverso", ordenInverso},
+    {"seleccion-simd", ordenSeleccionVectorial},
+    {"inverso-simd", ordenInversoVectorial},
+    {"seleccion-doble", ordenSeleccionDoble},
+    {"insercion", ordenInsercion},
+    {"introsort", ordenIntrosort},
+    {"radix", ordenRadix},
+    {"hibrido", ordenHibrido},
+    {"adaptativo", ordenAdaptativo},
+    {"adaptativo-inverso", ordenAdaptativoInverso},
+};
+
+#define NUM_MOTORES_ORDEN ((int)(sizeof(MOTORES_ORDEN) / sizeof(MOTORES_ORDEN[0])))
+
+/*
+FuncionOrden buscarMotorOrden(const char *nombre)
+Recibe: const char *nombre (nombre del motor, por ejemplo "introsort")
+Devuelve: FuncionOrden (función de ordenamiento, o NULL si el nombre no existe)
+Observaciones: Busca en MOTORES_ORDEN el motor seleccionado desde la linea de comandos.
+*/
+static inline FuncionOrden buscarMotorOrden(const char *nombre) {
+    for (int i = 0; i < NUM_MOTORES_ORDEN; i++) {
+        if (strcmp(MOTORES_ORDEN[i].nombre, nombre) == 0) {
+            return MOTORES_ORDEN[i].funcion;
+        }
+    }
+    return NULL;
+}
+
+#endif
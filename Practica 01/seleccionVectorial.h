@@ -0,0 +1,363 @@
+#ifndef SELECCION_VECTORIAL_H
+#define SELECCION_VECTORIAL_H
+
+/*
+Práctica 01 - Búsqueda vectorial del mínimo y del máximo para Selección
+
+El ciclo interno de ordenSeleccion (y de ordenInverso) recorre la parte desordenada buscando
+la posición del menor (mayor) elemento con un if por cada elemento. Aquí ese recorrido se hace
+con instrucciones SIMD: 8 enteros por instrucción con AVX2 o 4 con SSE4.1, sin saltos que
+dependan de los datos. Cada carril guarda su mejor valor y la posición donde lo vio; al final
+se elige, entre los carriles empatados, la posición más pequeña, así que el resultado es el
+mismo que el del ciclo escalar (la primera aparición) y el número de intercambios no cambia.
+
+La instrucción a usar se decide al ejecutar con __builtin_cpu_supports, de modo que el mismo
+programa compilado con "gcc 01randomTiempo.c -o randomTiempo" funciona en cualquier equipo; si el
+procesador no es x86 o el compilador no es GCC/Clang se usa la versión escalar.
+*/
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SELECCION_VECTORIAL_X86 1
+#include <immintrin.h>
+#endif
+
+// Busca la posición del menor o del mayor elemento de arreglo[0..n-1] (primera aparición)
+typedef int (*FuncionPosicion)(const int *arreglo, int n);
+
+/*
+int posicionMinimoEscalar(const int *arreglo, int n)
+Recibe: const int *arreglo, int n (al menos 1)
+Devuelve: int (posición de la primera aparición del mínimo)
+Observaciones: Es el ciclo interno original de ordenSeleccion; también termina los restos de
+las versiones vectoriales.
+*/
+static inline int posicionMinimoEscalar(const int *arreglo, int n) {
+    int pos = 0;
+    for (int i = 1; i < n; i++) {
+        if (arreglo[i] < arreglo[pos]) {
+            pos = i;
+        }
+    }
+    return pos;
+}
+
+static inline int posicionMaximoEscalar(const int *arreglo, int n) {
+    int pos = 0;
+    for (int i = 1; i < n; i++) {
+        if (arreglo[i] > arreglo[pos]) {
+            pos = i;
+        }
+    }
+    return pos;
+}
+
+/*
+void posicionesExtremosEscalar(const int *arreglo, int n, int *posMin, int *posMax)
+Recibe: const int *arreglo, int n (al menos 1), int *posMin, int *posMax (resultados)
+Devuelve: void (No retorna valor explícito)
+Observaciones: Mínimo y máximo en una sola pasada, para la Selección de dos extremos.
+*/
+static inline void posicionesExtremosEscalar(const int *arreglo, int n, int *posMin, int *posMax) {
+    int pmin = 0, pmax = 0;
+    for (int i = 1; i < n; i++) {
+        if (arreglo[i] < arreglo[pmin]) {
+            pmin = i;
+        }
+        if (arreglo[i] > arreglo[pmax]) {
+            pmax = i;
+        }
+    }
+    *posMin = pmin;
+    *posMax = pmax;
+}
+
+/*
+int elegirCarril(const int *valores, const int *posiciones, int carriles, int buscarMinimo)
+Recibe: valores y posiciones de cada carril, cuántos carriles hay y si se busca el mínimo (1) o el máximo (0)
+Devuelve: int (posición ganadora: el mejor valor y, entre empates, la posición menor)
+Observaciones: Reducción final de las versiones vectoriales.
+*/
+static inline int elegirCarril(const int *valores, const int *posiciones, int carriles, int buscarMinimo) {
+    int mejor = 0;
+    for (int c = 1; c < carriles; c++) {
+        int gana = buscarMinimo ? valores[c] < valores[mejor] : valores[c] > valores[mejor];
+        if (gana || (valores[c] == valores[mejor] && posiciones[c] < posiciones[mejor])) {
+            mejor = c;
+        }
+    }
+    return posiciones[mejor];
+}
+
+#ifdef SELECCION_VECTORIAL_X86
+
+/*
+Cuerpo común de las búsquedas vectoriales. Se usan dos acumuladores independientes para que
+una comparación no tenga que esperar a la anterior. En cada carril, "mejora" es la máscara de
+los elementos estrictamente mejores que el acumulado (estricto para conservar la primera
+aparición) y con ella se actualiza la posición guardada.
+  T: tipo del vector, A: enteros por vector, CARGAR/IGUAL/SUMAR/MEZCLAR/GUARDAR: intrínsecas,
+  MEJORA(acumulado, v): máscara de carriles donde v gana, EXTREMO(acumulado, v): mínimo o máximo.
+*/
+#define CUERPO_POSICION_VECTORIAL(T, A, CARGAR, IGUAL, SUMAR, MEZCLAR, GUARDAR, MEJORA, EXTREMO,   \
+                                  ESCALAR, BUSCAR_MINIMO)                                          \
+    if (n < 4 * (A)) {                                                                             \
+        return ESCALAR(arreglo, n);                                                                \
+    }                                                                                              \
+    int indices[2 * (A)];                                                                          \
+    for (int c = 0; c < 2 * (A); c++) {                                                            \
+        indices[c] = c;                                                                            \
+    }                                                                                              \
+    T idx0 = CARGAR((const T *)indices), idx1 = CARGAR((const T *)(indices + (A)));                \
+    T salto = IGUAL(2 * (A));                                                                      \
+    T ext0 = CARGAR((const T *)arreglo), ext1 = CARGAR((const T *)(arreglo + (A)));                \
+    T pos0 = idx0, pos1 = idx1;                                                                    \
+    int i = 2 * (A);                                                                               \
+    for (; i + 2 * (A) <= n; i += 2 * (A)) {                                                       \
+        idx0 = SUMAR(idx0, salto);                                                                 \
+        idx1 = SUMAR(idx1, salto);                                                                 \
+        T v0 = CARGAR((const T *)(arreglo + i));                                                   \
+        T v1 = CARGAR((const T *)(arreglo + i + (A)));                                             \
+        T mejora0 = MEJORA(ext0, v0);                                                              \
+        T mejora1 = MEJORA(ext1, v1);                                                              \
+        ext0 = EXTREMO(ext0, v0);                                                                  \
+        ext1 = EXTREMO(ext1, v1);                                                                  \
+        pos0 = MEZCLAR(pos0, idx0, mejora0);                                                       \
+        pos1 = MEZCLAR(pos1, idx1, mejora1);                                                       \
+    }                                                                                              \
+    int valores[2 * (A)], posiciones[2 * (A)];                                                     \
+    GUARDAR((T *)valores, ext0);                                                                   \
+    GUARDAR((T *)(valores + (A)), ext1);                                                           \
+    GUARDAR((T *)posiciones, pos0);                                                                \
+    GUARDAR((T *)(posiciones + (A)), pos1);                                                        \
+    int pos = elegirCarril(valores, posiciones, 2 * (A), BUSCAR_MINIMO);                           \
+    /* El resto va después de todo lo revisado, así que solo lo reemplaza un valor estrictamente mejor */ \
+    for (; i < n; i++) {                                                                           \
+        if (BUSCAR_MINIMO ? arreglo[i] < arreglo[pos] : arreglo[i] > arreglo[pos]) {               \
+            pos = i;                                                                               \
+        }                                                                                          \
+    }                                                                                              \
+    return pos;
+
+#define MEJORA_MIN_AVX2(ext, v) _mm256_cmpgt_epi32((ext), (v))
+#define MEJORA_MAX_AVX2(ext, v) _mm256_cmpgt_epi32((v), (ext))
+#define MEJORA_MIN_SSE41(ext, v) _mm_cmpgt_epi32((ext), (v))
+#define MEJORA_MAX_SSE41(ext, v) _mm_cmpgt_epi32((v), (ext))
+
+__attribute__((target("avx2")))
+static inline int posicionMinimoAVX2(const int *arreglo, int n) {
+    CUERPO_POSICION_VECTORIAL(__m256i, 8, _mm256_loadu_si256, _mm256_set1_epi32, _mm256_add_epi32,
+                              _mm256_blendv_epi8, _mm256_storeu_si256, MEJORA_MIN_AVX2, _mm256_min_epi32,
+                              posicionMinimoEscalar, 1)
+}
+
+__attribute__((target("avx2")))
+static inline int posicionMaximoAVX2(const int *arreglo, int n) {
+    CUERPO_POSICION_VECTORIAL(__m256i, 8, _mm256_loadu_si256, _mm256_set1_epi32, _mm256_add_epi32,
+                              _mm256_blendv_epi8, _mm256_storeu_si256, MEJORA_MAX_AVX2, _mm256_max_epi32,
+                              posicionMaximoEscalar, 0)
+}
+
+__attribute__((target("sse4.1")))
+static inline int posicionMinimoSSE41(const int *arreglo, int n) {
+    CUERPO_POSICION_VECTORIAL(__m128i, 4, _mm_loadu_si128, _mm_set1_epi32, _mm_add_epi32,
+                              _mm_blendv_epi8, _mm_storeu_si128, MEJORA_MIN_SSE41, _mm_min_epi32,
+                              posicionMinimoEscalar, 1)
+}
+
+__attribute__((target("sse4.1")))
+static inline int posicionMaximoSSE41(const int *arreglo, int n) {
+    CUERPO_POSICION_VECTORIAL(__m128i, 4, _mm_loadu_si128, _mm_set1_epi32, _mm_add_epi32,
+                              _mm_blendv_epi8, _mm_storeu_si128, MEJORA_MAX_SSE41, _mm_max_epi32,
+                              posicionMaximoEscalar, 0)
+}
+
+/*
+void posicionesExtremosAVX2(const int *arreglo, int n, int *posMin, int *posMax)
+Observaciones: Versión AVX2 de posicionesExtremosEscalar: cada vector cargado alimenta a la vez
+el acumulado del mínimo y el del máximo, así que la pasada lee la memoria una sola vez.
+*/
+__attribute__((target("avx2")))
+static inline void posicionesExtremosAVX2(const int *arreglo, int n, int *posMin, int *posMax) {
+    if (n < 16) {
+        posicionesExtremosEscalar(arreglo, n, posMin, posMax);
+        return;
+    }
+    __m256i idx = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i salto = _mm256_set1_epi32(8);
+    __m256i vmin = _mm256_loadu_si256((const __m256i *)arreglo), vmax = vmin;
+    __m256i pmin = idx, pmax = idx;
+    int i = 8;
+    for (; i + 8 <= n; i += 8) {
+        idx = _mm256_add_epi32(idx, salto);
+        __m256i v = _mm256_loadu_si256((const __m256i *)(arreglo + i));
+        pmin = _mm256_blendv_epi8(pmin, idx, _mm256_cmpgt_epi32(vmin, v));
+        pmax = _mm256_blendv_epi8(pmax, idx, _mm256_cmpgt_epi32(v, vmax));
+        vmin = _mm256_min_epi32(vmin, v);
+        vmax = _mm256_max_epi32(vmax, v);
+    }
+    int valores[8], posiciones[8];
+    _mm256_storeu_si256((__m256i *)valores, vmin);
+    _mm256_storeu_si256((__m256i *)posiciones, pmin);
+    int pos1 = elegirCarril(valores, posiciones, 8, 1);
+    _mm256_storeu_si256((__m256i *)valores, vmax);
+    _mm256_storeu_si256((__m256i *)posiciones, pmax);
+    int pos2 = elegirCarril(valores, posiciones, 8, 0);
+    for (; i < n; i++) {
+        if (arreglo[i] < arreglo[pos1]) {
+            pos1 = i;
+        }
+        if (arreglo[i] > arreglo[pos2]) {
+            pos2 = i;
+        }
+    }
+    *posMin = pos1;
+    *posMax = pos2;
+}
+
+__attribute__((target("sse4.1")))
+static inline void posicionesExtremosSSE41(const int *arreglo, int n, int *posMin, int *posMax) {
+    if (n < 8) {
+        posicionesExtremosEscalar(arreglo, n, posMin, posMax);
+        return;
+    }
+    __m128i idx = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i salto = _mm_set1_epi32(4);
+    __m128i vmin = _mm_loadu_si128((const __m128i *)arreglo), vmax = vmin;
+    __m128i pmin = idx, pmax = idx;
+    int i = 4;
+    for (; i + 4 <= n; i += 4) {
+        idx = _mm_add_epi32(idx, salto);
+        __m128i v = _mm_loadu_si128((const __m128i *)(arreglo + i));
+        pmin = _mm_blendv_epi8(pmin, idx, _mm_cmpgt_epi32(vmin, v));
+        pmax = _mm_blendv_epi8(pmax, idx, _mm_cmpgt_epi32(v, vmax));
+        vmin = _mm_min_epi32(vmin, v);
+        vmax = _mm_max_epi32(vmax, v);
+    }
+    int valores[4], posiciones[4];
+    _mm_storeu_si128((__m128i *)valores, vmin);
+    _mm_storeu_si128((__m128i *)posiciones, pmin);
+    int pos1 = elegirCarril(valores, posiciones, 4, 1);
+    _mm_storeu_si128((__m128i *)valores, vmax);
+    _mm_storeu_si128((__m128i *)posiciones, pmax);
+    int pos2 = elegirCarril(valores, posiciones, 4, 0);
+    for (; i < n; i++) {
+        if (arreglo[i] < arreglo[pos1]) {
+            pos1 = i;
+        }
+        if (arreglo[i] > arreglo[pos2]) {
+            pos2 = i;
+        }
+    }
+    *posMin = pos1;
+    *posMax = pos2;
+}
+
+#endif
+
+typedef void (*FuncionExtremos)(const int *arreglo, int n, int *posMin, int *posMax);
+
+// Versiones elegidas para el procesador en que se ejecuta el programa
+typedef struct {
+    const char *nombre;          // "avx2", "sse4.1" o "escalar"
+    FuncionPosicion minimo;
+    FuncionPosicion maximo;
+    FuncionExtremos extremos;
+} NucleoSeleccion;
+
+/*
+const NucleoSeleccion *nucleoSeleccion()
+Recibe: void (No recibe parámetros)
+Devuelve: const NucleoSeleccion * (funciones de búsqueda más rápidas que soporta el procesador)
+Observaciones: La detección se hace una sola vez. Con la variable de entorno SELECCION_ESCALAR
+definida se fuerza la versión escalar, para comparar contra ella con el mismo ejecutable.
+*/
+static inline const NucleoSeleccion *nucleoSeleccion(void) {
+    static const NucleoSeleccion escalar = {"escalar", posicionMinimoEscalar, posicionMaximoEscalar,
+                                            posicionesExtremosEscalar};
+#ifdef SELECCION_VECTORIAL_X86
+    static const NucleoSeleccion avx2 = {"avx2", posicionMinimoAVX2, posicionMaximoAVX2, posicionesExtremosAVX2};
+    static const NucleoSeleccion sse41 = {"sse4.1", posicionMinimoSSE41, posicionMaximoSSE41,
+                                          posicionesExtremosSSE41};
+#endif
+    static const NucleoSeleccion *elegido = NULL;
+    if (elegido == NULL) {
+        elegido = &escalar;
+#ifdef SELECCION_VECTORIAL_X86
+        if (getenv("SELECCION_ESCALAR") == NULL) {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                elegido = &avx2;
+            } else if (__builtin_cpu_supports("sse4.1")) {
+                elegido = &sse41;
+            }
+        }
+#endif
+    }
+    return elegido;
+}
+
+/*
+void ordenSeleccionVectorial(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Mismo algoritmo e intercambios que ordenSeleccion; solo cambia cómo se busca el mínimo.
+*/
+static inline void ordenSeleccionVectorial(int *arregloDes, int n) {
+    FuncionPosicion posicionMinimo = nucleoSeleccion()->minimo;
+    for (int k = 0; k <= (n - 2); k++) {
+        int posMin = k + posicionMinimo(arregloDes + k, n - k);
+        int temp = arregloDes[posMin];
+        arregloDes[posMin] = arregloDes[k];
+        arregloDes[k] = temp;
+    }
+}
+
+/*
+void ordenInversoVectorial(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Mismo algoritmo e intercambios que ordenInverso (de mayor a menor).
+*/
+static inline void ordenInversoVectorial(int *arregloDes, int n) {
+    FuncionPosicion posicionMaximo = nucleoSeleccion()->maximo;
+    for (int k = 0; k <= (n - 2); k++) {
+        int posMax = k + posicionMaximo(arregloDes + k, n - k);
+        int temp = arregloDes[posMax];
+        arregloDes[posMax] = arregloDes[k];
+        arregloDes[k] = temp;
+    }
+}
+
+/*
+void ordenSeleccionDoble(int *arregloDes, int n)
+Recibe: int * arreglo (puntero) como arregloDes y n como tamaño del arreglo
+Devuelve: void (No retorna valor explícito)
+Observaciones: Selección de dos extremos: cada pasada encuentra el mínimo y el máximo de la parte
+desordenada y los coloca en ambos extremos, así que se hacen n/2 pasadas en lugar de n-1.
+*/
+static inline void ordenSeleccionDoble(int *arregloDes, int n) {
+    FuncionExtremos posicionesExtremos = nucleoSeleccion()->extremos;
+    int ini = 0, fin = n - 1;
+    while (ini < fin) {
+        int posMin, posMax;
+        posicionesExtremos(arregloDes + ini, fin - ini + 1, &posMin, &posMax);
+        posMin += ini;
+        posMax += ini;
+
+        int temp = arregloDes[posMin];
+        arregloDes[posMin] = arregloDes[ini];
+        arregloDes[ini] = temp;
+        // Si el máximo estaba en ini, el intercambio anterior lo movió a posMin
+        if (posMax == ini) {
+            posMax = posMin;
+        }
+        temp = arregloDes[posMax];
+        arregloDes[posMax] = arregloDes[fin];
+        arregloDes[fin] = temp;
+
+        ini++;
+        fin--;
+    }
+}
+
+#endif
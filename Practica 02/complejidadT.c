@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <time.h>
 #include <stdlib.h>
+#include <string.h>
+#include "../Comun/medicion.h"
 
 /* 
 Práctica 02 - Análisis y Diseño de Algoritmos - Garcia Ambrosio Aldo 3CM1 2025
@@ -13,78 +15,111 @@ Debes obtener tres gráficas diferentes.
 Ejecución: gcc "complejidadT.c" -o complejidadT
            ./complejidadT {numero} > salida.txt
 Ejemplo:   ./complejidadT 100000 > numerosmillon.txt
+
+Opciones:  --repeticiones {r}   Corridas medidas por función (por defecto 1)
+           --calentamiento {w}  Corridas previas sin medir (por defecto 0)
+           --formato {f}        texto (por defecto, el que procesa ScriptPy/procesoDatos.py), csv o json
+Ejemplo:   ./complejidadT 100000 --repeticiones 21 --calentamiento 3 --formato csv > salida.csv
+
+Modo barrido: --desde {a} --hasta {b} --paso {c} recorre n = a, a+c, ... hasta b en un solo proceso
+(sin {numero}), repitiendo el bloque de texto de cada n para que procesoDatos.py lo siga leyendo.
+Sin --desde empieza en c; sin --paso, c = 1 y a = b (las mismas reglas que randomTiempo de la Practica 01).
+Ejemplo:   ./complejidadT --desde 1000 --hasta 1000000 --paso 1000 > salida.txt
+
+Los tiempos se miden con el reloj monotónico de Comun/medicion.h. Cada ciclo pasa su contador por
+MANTENER() en cada iteración para que el compilador no pueda eliminar el ciclo con -O2.
 */
 
 /*
-void cicloSuma(int n)
+int cicloSuma(int n)
 Recibe: int n como el límite superior para el ciclo de incremento de 2 en 2
-Devuelve: void (No retorna valor explícito)
-Observaciones: Función que ejecuta un ciclo que incrementa de 2 en 2 desde 1 hasta n,
-               midiendo el tiempo de ejecución. Tiene complejidad temporal O(n/2) ≈ O(n)
-               debido a que itera aproximadamente n/2 veces.
+Devuelve: int (número de iteraciones realizadas)
+Observaciones: Función que ejecuta un ciclo que incrementa de 2 en 2 desde 1 hasta n.
+               Tiene complejidad temporal O(n/2) ≈ O(n) debido a que itera aproximadamente
+               n/2 veces. El tiempo lo mide main con Comun/medicion.h.
 */
-void cicloSuma(int n) {
-    if (n <= 0) return;
-    
-    clock_t t = clock();
+int cicloSuma(int n) {
+    if (n <= 0) return 0;
     
     int j = 0;
     // Ciclo que incrementa de 2 en 2 desde 1 hasta n
     for (int i = 1; i <= n; i += 2) {
-        j++; // Contador de iteraciones (opcional para debugging)
+        j++; // Contador de iteraciones
+        MANTENER(j); // Evita que -O2 reemplace el ciclo por una fórmula
     }
     
-    t = clock() - t;
-    double time_taken = ((double)t) / CLOCKS_PER_SEC;
-    printf("A cicloSuma le tomó %f segundos ejecutarse", time_taken);
+    return j;
 }
 
 /*
-void cicloMultiplicacion(int n)
+int cicloMultiplicacion(int n)
 Recibe: int n como el límite superior para el ciclo de multiplicación por 2
-Devuelve: void (No retorna valor explícito)
-Observaciones: Función que ejecuta un ciclo que multiplica por 2 en cada iteración desde 1 hasta n,
-               midiendo el tiempo de ejecución. Tiene complejidad temporal O(log n) debido a que
-               el número de iteraciones es logarítmico base 2 respecto a n.
+Devuelve: int (número de iteraciones realizadas)
+Observaciones: Función que ejecuta un ciclo que multiplica por 2 en cada iteración desde 1 hasta n.
+               Tiene complejidad temporal O(log n) debido a que el número de iteraciones es
+               logarítmico base 2 respecto a n. El tiempo lo mide main con Comun/medicion.h.
 */
-void cicloMultiplicacion(int n) {
-    if (n <= 0) return;
-    
-    clock_t t = clock();
+int cicloMultiplicacion(int n) {
+    if (n <= 0) return 0;
     
     int j = 0;
     // Ciclo que multiplica por 2 en cada iteración desde 1 hasta n
     for (int i = 1; i <= n; i *= 2) {
-        j++; // Contador de iteraciones (opcional para debugging)
+        j++; // Contador de iteraciones
+        MANTENER(j); // Evita que -O2 reemplace el ciclo por una fórmula
     }
     
-    t = clock() - t;
-    double time_taken = ((double)t) / CLOCKS_PER_SEC;
-    printf("A cicloMultiplicacion le tomó %f segundos ejecutarse", time_taken);
+    return j;
 }
 
 /*
-void cicloResta(int n)
+int cicloResta(int n)
 Recibe: int n como el valor inicial para el ciclo de decremento de 2 en 2
-Devuelve: void (No retorna valor explícito)
-Observaciones: Función que ejecuta un ciclo que decrementa de 2 en 2 desde n hasta 0,
-               midiendo el tiempo de ejecución. Tiene complejidad temporal O(n/2) ≈ O(n)
-               debido a que itera aproximadamente n/2 veces.
+Devuelve: int (número de iteraciones realizadas)
+Observaciones: Función que ejecuta un ciclo que decrementa de 2 en 2 desde n hasta 0.
+               Tiene complejidad temporal O(n/2) ≈ O(n) debido a que itera aproximadamente
+               n/2 veces. El tiempo lo mide main con Comun/medicion.h.
 */
-void cicloResta(int n) {
-    if (n <= 0) return;
-    
-    clock_t t = clock();
+int cicloResta(int n) {
+    if (n <= 0) return 0;
     
     int j = 0;
     // Ciclo que decrementa de 2 en 2 desde n hasta 0
     for (int i = n; i > 0; i -= 2) {
-        j++; // Contador de iteraciones (opcional para debugging)
+        j++; // Contador de iteraciones
+        MANTENER(j); // Evita que -O2 reemplace el ciclo por una fórmula
     }
     
-    t = clock() - t;
-    double time_taken = ((double)t) / CLOCKS_PER_SEC;
-    printf("A cicloResta le tomó %f segundos ejecutarse", time_taken);
+    return j;
+}
+
+// Datos de una medición de ciclo: la función, su n y el resultado (para que no se descarte)
+typedef struct {
+    int (*ciclo)(int n);
+    int n;
+    int iteraciones;
+} CorridaCiclo;
+
+void ejecutarCiclo(void *datos) {
+    CorridaCiclo *corrida = (CorridaCiclo *)datos;
+    corrida->iteraciones = corrida->ciclo(corrida->n);
+}
+
+/*
+void medirCiclo(const char *nombre, int (*ciclo)(int), int n, Medicion *medicion, FormatoMedicion formato)
+Recibe: nombre de la función, la función de ciclo, n, la medición a reutilizar y el formato de salida
+Devuelve: void (No retorna valor explícito)
+Observaciones: En formato texto imprime la misma línea que antes ("A {nombre} le tomó ... segundos
+               ejecutarse") con la mediana de las repeticiones; en csv/json una fila por función.
+*/
+void medirCiclo(const char *nombre, int (*ciclo)(int), int n, Medicion *medicion, FormatoMedicion formato) {
+    CorridaCiclo corrida = {ciclo, n, 0};
+    medir(medicion, NULL, ejecutarCiclo, &corrida);
+    if (formato == FORMATO_TEXTO) {
+        printf("A %s le tomó %f segundos ejecutarse", nombre, medicion->mediana);
+    } else {
+        imprimirMedicion(formato, nombre, n, "ciclo", medicion);
+    }
 }
 
 /*
@@ -94,36 +129,96 @@ Recibe: int num_arg (número de argumentos de línea de comandos),
 Devuelve: int (código de salida del programa, 0 indica ejecución exitosa)
 Observaciones: Función principal que valida los argumentos de entrada, ejecuta las tres funciones
                de análisis de complejidad temporal y muestra los resultados de tiempo de ejecución.
-               Requiere exactamente un argumento numérico positivo como parámetro.
+               Requiere un argumento numérico positivo, o un rango --desde/--hasta/--paso.
 */
 int main(int num_arg, char *arg_user[]) {
     
     // Validación del número de argumentos
-    if (num_arg != 2) {
-        printf("Uso: %s <numero_entero_positivo>\n", arg_user[0]);
+    if (num_arg < 2) {
+        printf("Uso: %s <numero_entero_positivo> [--repeticiones r] [--calentamiento w] [--formato texto|csv|json]\n", arg_user[0]);
+        printf("     %s --desde a --hasta b --paso c [opciones]\n", arg_user[0]);
         printf("Ejemplo: %s 1000\n", arg_user[0]);
         exit(1);
     }
     
-    // Conversión del argumento a entero
-    int n = atoi(arg_user[1]);
-    
+    // Conversión del argumento a entero (se omite en modo barrido)
+    int n = 0;
+    int primeraOpcion = 1;
+    if (strncmp(arg_user[1], "--", 2) != 0) {
+        n = atoi(arg_user[1]);
+        primeraOpcion = 2;
+    }
+
+    int repeticiones = 1, calentamiento = 0;
+    FormatoMedicion formato = FORMATO_TEXTO;
+    int desde = 0, hasta = 0, paso = 0;
+    for (int i = primeraOpcion; i < num_arg; i++) {
+        if (strcmp(arg_user[i], "--repeticiones") == 0 && i + 1 < num_arg) {
+            repeticiones = atoi(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--calentamiento") == 0 && i + 1 < num_arg) {
+            calentamiento = atoi(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--formato") == 0 && i + 1 < num_arg && formatoDesdeTexto(arg_user[i + 1], &formato)) {
+            i++;
+        } else if (strcmp(arg_user[i], "--desde") == 0 && i + 1 < num_arg) {
+            desde = atoi(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--hasta") == 0 && i + 1 < num_arg) {
+            hasta = atoi(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--paso") == 0 && i + 1 < num_arg) {
+            paso = atoi(arg_user[++i]);
+        } else {
+            printf("Opcion no reconocida: %s\n", arg_user[i]);
+            exit(1);
+        }
+    }
+
+    // Sin barrido, el rango es solo n
+    if (hasta <= 0) {
+        desde = hasta = n;
+    }
+    if (desde <= 0) desde = paso > 0 ? paso : hasta;
+    if (paso <= 0) paso = 1;
+
     // Validación de que el número sea positivo
-    if (n <= 0) {
+    if (desde <= 0) {
         printf("Error: el número debe ser positivo (mayor que 0)\n");
         exit(1);
     }
+    if (desde > hasta) {
+        printf("Error: --desde (%d) debe ser menor o igual que --hasta (%d)\n", desde, hasta);
+        exit(1);
+    }
+
+    Medicion medicion;
+    if (!medicionCrear(&medicion, calentamiento, repeticiones)) {
+        printf("Error: No se pudo asignar memoria\n");
+        exit(1);
+    }
     
-    printf("\nInicia la prueba de complejidad con n = %d\n", n);
-    
-    // Ejecutar los diferentes tipos de ciclos y medir sus tiempos
-    printf("\n");
-    cicloSuma(n);          // Complejidad O(n/2) ≈ O(n)
-    printf("\n");
-    cicloMultiplicacion(n); // Complejidad O(log n)
-    printf("\n");
-    cicloResta(n);         // Complejidad O(n/2) ≈ O(n)
-    
-    printf("\n\nPrueba completada.\n");
+    imprimirEncabezadoMedicion(formato);
+    // El contador es de 64 bits: con hasta cerca de INT_MAX, n + paso se desbordaría en un int
+    for (long long m = desde; m <= hasta; m += paso) {
+        n = (int)m;
+        if (formato == FORMATO_TEXTO) {
+            printf("\nInicia la prueba de complejidad con n = %d\n", n);
+            
+            // Ejecutar los diferentes tipos de ciclos y medir sus tiempos
+            printf("\n");
+            medirCiclo("cicloSuma", cicloSuma, n, &medicion, formato);                     // Complejidad O(n/2) ≈ O(n)
+            printf("\n");
+            medirCiclo("cicloMultiplicacion", cicloMultiplicacion, n, &medicion, formato); // Complejidad O(log n)
+            printf("\n");
+            medirCiclo("cicloResta", cicloResta, n, &medicion, formato);                   // Complejidad O(n/2) ≈ O(n)
+            
+            printf("\n\nPrueba completada.\n");
+        } else {
+            medirCiclo("cicloSuma", cicloSuma, n, &medicion, formato);
+            medirCiclo("cicloMultiplicacion", cicloMultiplicacion, n, &medicion, formato);
+            medirCiclo("cicloResta", cicloResta, n, &medicion, formato);
+        }
+        // Emitir cada n en cuanto termina
+        fflush(stdout);
+    }
+
+    medicionLiberar(&medicion);
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,401 @@
+#ifndef ALMACEN_ALUMNOS_H
+#define ALMACEN_ALUMNOS_H
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Práctica 04 - Almacén columnar de alumnos
+
+En script.c cada Alumno es una estructura de 96 bytes con sus cadenas de tamaño fijo, así que
+recorrer un solo campo (contar por grupo, filtrar por especialidad) lee los 96 bytes de cada
+registro. Aquí los alumnos se guardan por columnas:
+    matricula[i]      int
+    grupo[i]          identificador (uint16_t) del grupo en el diccionario de grupos
+    especialidad[i]   identificador (uint16_t) en el diccionario de especialidades
+    nombre            todos los nombres seguidos en una sola arena de caracteres; el nombre del
+                      alumno i empieza en arenaNombres + inicioNombre[i]
+Contar por grupo recorre 2 bytes por alumno y ordenar por matrícula solo mueve enteros.
+Los grupos y especialidades se internan: cada texto distinto se guarda una vez y se identifica
+por su número, asignado en el orden en que aparece.
+
+El CSV tiene una línea por alumno con los campos de Alumno en el mismo orden:
+    nombre,especialidad,matricula,grupo
+Las líneas cuya matrícula no es numérica (como un encabezado) o no cabe en un int se ignoran.
+Los campos pueden ir entre comillas dobles (sin comillas dentro del campo).
+*/
+
+// Máximo de textos distintos en un diccionario (los identificadores son uint16_t)
+#define MAX_TEXTOS_DICCIONARIO 65535
+
+typedef struct {
+    char **textos;        // textos[id]
+    uint32_t cantidad;
+    uint32_t capacidad;
+    uint32_t *tabla;      // Tabla hash con direccionamiento abierto: id + 1, o 0 si está libre
+    uint32_t tamTabla;    // Potencia de 2
+} Diccionario;
+
+typedef struct {
+    size_t n;
+    size_t capacidad;
+    int *matricula;
+    uint16_t *grupo;
+    uint16_t *especialidad;
+    size_t *inicioNombre;
+    char *arenaNombres;
+    size_t tamArena;
+    size_t capArena;
+    Diccionario grupos;
+    Diccionario especialidades;
+} AlmacenAlumnos;
+
+static inline uint32_t hashTexto(const char *texto, size_t lon) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    for (size_t i = 0; i < lon; i++) {
+        h = (h ^ (unsigned char)texto[i]) * 16777619u;
+    }
+    return h;
+}
+
+/*
+int diccionarioInternar(Diccionario *d, const char *texto, size_t lon)
+Recibe: Diccionario *d, const char *texto (no necesita terminar en '\0'), size_t lon
+Devuelve: int (identificador del texto, o -1 si no hubo memoria o se llenó el diccionario)
+Observaciones: Si el texto ya estaba regresa el mismo identificador.
+*/
+static inline int diccionarioInternar(Diccionario *d, const char *texto, size_t lon) {
+    // Mantener la tabla a lo más a la mitad de su capacidad
+    if (2 * (d->cantidad + 1) > d->tamTabla) {
+        uint32_t nuevoTam = d->tamTabla ? 2 * d->tamTabla : 64;
+        uint32_t *nueva = calloc(nuevoTam, sizeof(uint32_t));
+        if (nueva == NULL) {
+            return -1;
+        }
+        for (uint32_t id = 0; id < d->cantidad; id++) {
+            uint32_t h = hashTexto(d->textos[id], strlen(d->textos[id])) & (nuevoTam - 1);
+            while (nueva[h] != 0) {
+                h = (h + 1) & (nuevoTam - 1);
+            }
+            nueva[h] = id + 1;
+        }
+        free(d->tabla);
+        d->tabla = nueva;
+        d->tamTabla = nuevoTam;
+    }
+
+    uint32_t h = hashTexto(texto, lon) & (d->tamTabla - 1);
+    while (d->tabla[h] != 0) {
+        const char *existente = d->textos[d->tabla[h] - 1];
+        if (strncmp(existente, texto, lon) == 0 && existente[lon] == '\0') {
+            return (int)(d->tabla[h] - 1);
+        }
+        h = (h + 1) & (d->tamTabla - 1);
+    }
+
+    if (d->cantidad >= MAX_TEXTOS_DICCIONARIO) {
+        return -1;
+    }
+    if (d->cantidad == d->capacidad) {
+        uint32_t nuevaCap = d->capacidad ? 2 * d->capacidad : 16;
+        char **textos = realloc(d->textos, nuevaCap * sizeof(char *));
+        if (textos == NULL) {
+            return -1;
+        }
+        d->textos = textos;
+        d->capacidad = nuevaCap;
+    }
+    char *copia = malloc(lon + 1);
+    if (copia == NULL) {
+        return -1;
+    }
+    memcpy(copia, texto, lon);
+    copia[lon] = '\0';
+    d->textos[d->cantidad] = copia;
+    d->tabla[h] = d->cantidad + 1;
+    return (int)d->cantidad++;
+}
+
+static inline void diccionarioLiberar(Diccionario *d) {
+    for (uint32_t i = 0; i < d->cantidad; i++) {
+        free(d->textos[i]);
+    }
+    free(d->textos);
+    free(d->tabla);
+    memset(d, 0, sizeof(*d));
+}
+
+static inline void almacenIniciar(AlmacenAlumnos *a) {
+    memset(a, 0, sizeof(*a));
+}
+
+static inline void almacenLiberar(AlmacenAlumnos *a) {
+    free(a->matricula);
+    free(a->grupo);
+    free(a->especialidad);
+    free(a->inicioNombre);
+    free(a->arenaNombres);
+    diccionarioLiberar(&a->grupos);
+    diccionarioLiberar(&a->especialidades);
+    almacenIniciar(a);
+}
+
+/*
+int almacenReservar(AlmacenAlumnos *a, size_t capacidad)
+Recibe: AlmacenAlumnos *a, size_t capacidad (alumnos que deben caber)
+Devuelve: int (1 si se pudo reservar, 0 en caso contrario)
+Observaciones: Crece todas las columnas a la vez. Si no hay memoria las columnas anteriores siguen válidas.
+*/
+static inline int almacenReservar(AlmacenAlumnos *a, size_t capacidad) {
+    if (capacidad <= a->capacidad) {
+        return 1;
+    }
+    int *matricula = realloc(a->matricula, capacidad * sizeof(int));
+    if (matricula == NULL) return 0;
+    a->matricula = matricula;
+    uint16_t *grupo = realloc(a->grupo, capacidad * sizeof(uint16_t));
+    if (grupo == NULL) return 0;
+    a->grupo = grupo;
+    uint16_t *especialidad = realloc(a->especialidad, capacidad * sizeof(uint16_t));
+    if (especialidad == NULL) return 0;
+    a->especialidad = especialidad;
+    size_t *inicioNombre = realloc(a->inicioNombre, capacidad * sizeof(size_t));
+    if (inicioNombre == NULL) return 0;
+    a->inicioNombre = inicioNombre;
+    a->capacidad = capacidad;
+    return 1;
+}
+
+/*
+int almacenAgregar(AlmacenAlumnos *a, const char *nombre, size_t lonNombre, const char *especialidad,
+                   size_t lonEspecialidad, int matricula, const char *grupo, size_t lonGrupo)
+Recibe: el almacén y los campos de un alumno (las cadenas no necesitan terminar en '\0')
+Devuelve: int (1 si se agregó, 0 si no hubo memoria o se llenó un diccionario)
+*/
+static inline int almacenAgregar(AlmacenAlumnos *a, const char *nombre, size_t lonNombre, const char *especialidad,
+                                 size_t lonEspecialidad, int matricula, const char *grupo, size_t lonGrupo) {
+    if (a->n == a->capacidad && !almacenReservar(a, a->capacidad ? 2 * a->capacidad : 1024)) {
+        return 0;
+    }
+    if (a->tamArena + lonNombre + 1 > a->capArena) {
+        size_t nuevaCap = a->capArena ? 2 * a->capArena : 16384;
+        while (nuevaCap < a->tamArena + lonNombre + 1) {
+            nuevaCap *= 2;
+        }
+        char *arena = realloc(a->arenaNombres, nuevaCap);
+        if (arena == NULL) {
+            return 0;
+        }
+        a->arenaNombres = arena;
+        a->capArena = nuevaCap;
+    }
+    int idGrupo = diccionarioInternar(&a->grupos, grupo, lonGrupo);
+    int idEspecialidad = diccionarioInternar(&a->especialidades, especialidad, lonEspecialidad);
+    if (idGrupo < 0 || idEspecialidad < 0) {
+        return 0;
+    }
+
+    size_t i = a->n++;
+    a->matricula[i] = matricula;
+    a->grupo[i] = (uint16_t)idGrupo;
+    a->especialidad[i] = (uint16_t)idEspecialidad;
+    a->inicioNombre[i] = a->tamArena;
+    memcpy(a->arenaNombres + a->tamArena, nombre, lonNombre);
+    a->tamArena += lonNombre;
+    a->arenaNombres[a->tamArena++] = '\0';
+    return 1;
+}
+
+static inline const char *almacenNombre(const AlmacenAlumnos *a, size_t i) {
+    return a->arenaNombres + a->inicioNombre[i];
+}
+
+/*
+const char *siguienteCampoCSV(const char *p, const char *fin, const char **campo, size_t *lon)
+Recibe: p (inicio del campo), fin (fin de la línea), campo y lon (resultado, sin comillas ni espacios
+        alrededor)
+Devuelve: const char * (inicio del siguiente campo, o fin si era el último)
+*/
+static inline const char *siguienteCampoCSV(const char *p, const char *fin, const char **campo, size_t *lon) {
+    while (p < fin && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    const char *ini, *fc;
+    if (p < fin && *p == '"') {
+        ini = ++p;
+        const char *cierre = memchr(p, '"', (size_t)(fin - p));
+        fc = cierre ? cierre : fin;
+        p = fc + (cierre != NULL);
+        const char *coma = memchr(p, ',', (size_t)(fin - p));
+        p = coma ? coma + 1 : fin;
+    } else {
+        ini = p;
+        const char *coma = memchr(p, ',', (size_t)(fin - p));
+        fc = coma ? coma : fin;
+        p = coma ? coma + 1 : fin;
+        while (fc > ini && (fc[-1] == ' ' || fc[-1] == '\t' || fc[-1] == '\r')) {
+            fc--;
+        }
+    }
+    *campo = ini;
+    *lon = (size_t)(fc - ini);
+    return p;
+}
+
+/*
+long long almacenCargarCSV(AlmacenAlumnos *a, const char *ruta)
+Recibe: AlmacenAlumnos *a (ya iniciado; los alumnos se agregan al final), const char *ruta (NULL = entrada estándar)
+Devuelve: long long (alumnos agregados, o -1 si el archivo no se pudo abrir o faltó memoria)
+Observaciones: Lee el archivo en bloques de 1 MiB con fread y separa líneas y campos con memchr. Las
+líneas vacías, con menos de 4 campos o con matrícula no numérica o fuera de int se ignoran.
+*/
+static inline long long almacenCargarCSV(AlmacenAlumnos *a, const char *ruta) {
+    FILE *archivo = ruta ? fopen(ruta, "rb") : stdin;
+    if (archivo == NULL) {
+        return -1;
+    }
+    size_t capBloque = 1 << 20;
+    char *bloque = malloc(capBloque);
+    if (bloque == NULL) {
+        if (archivo != stdin) fclose(archivo);
+        return -1;
+    }
+    long long agregados = 0;
+    size_t pendientes = 0;
+    int error = 0;
+    for (;;) {
+        size_t leidos = fread(bloque + pendientes, 1, capBloque - pendientes, archivo);
+        size_t lon = pendientes + leidos;
+        int ultimo = (leidos == 0);
+        const char *p = bloque, *finBloque = bloque + lon;
+        for (;;) {
+            const char *salto = memchr(p, '\n', (size_t)(finBloque - p));
+            if (salto == NULL && !(ultimo && p < finBloque)) {
+                break;   // Línea incompleta: se completa con el siguiente bloque
+            }
+            const char *finLinea = salto ? salto : finBloque;
+
+            const char *nombre, *especialidad, *textoMatricula, *grupo;
+            size_t lonNombre, lonEspecialidad, lonMatricula, lonGrupo;
+            const char *q = siguienteCampoCSV(p, finLinea, &nombre, &lonNombre);
+            q = siguienteCampoCSV(q, finLinea, &especialidad, &lonEspecialidad);
+            q = siguienteCampoCSV(q, finLinea, &textoMatricula, &lonMatricula);
+            int completa = (q < finLinea);
+            siguienteCampoCSV(q, finLinea, &grupo, &lonGrupo);
+
+            // Matrícula: dígitos con signo opcional que caben en un int; 11 caracteres no
+            // desbordan el long long, y lo que no cabe se rechaza igual que lo que no es número
+            int negativa = (lonMatricula > 0 && textoMatricula[0] == '-');
+            int numerica = lonMatricula > (size_t)negativa && lonMatricula <= 11;
+            long long matricula = 0;
+            for (size_t k = (size_t)negativa; k < lonMatricula && numerica; k++) {
+                unsigned d = (unsigned)(textoMatricula[k] - '0');
+                numerica = d <= 9;
+                matricula = matricula * 10 + d;
+            }
+            if (negativa) {
+                matricula = -matricula;
+            }
+            numerica = numerica && matricula >= INT_MIN && matricula <= INT_MAX;
+
+            if (completa && numerica) {
+                int valor = (int)matricula;
+                if (!almacenAgregar(a, nombre, lonNombre, especialidad, lonEspecialidad, valor, grupo, lonGrupo)) {
+                    error = 1;
+                    break;
+                }
+                agregados++;
+            }
+            p = salto ? salto + 1 : finBloque;
+        }
+        if (error || ultimo) {
+            break;
+        }
+        pendientes = (size_t)(finBloque - p);
+        if (pendientes == capBloque) {
+            // Una línea ocupa todo el bloque: se duplica
+            char *mayor = realloc(bloque, 2 * capBloque);
+            if (mayor == NULL) {
+                error = 1;
+                break;
+            }
+            bloque = mayor;
+            capBloque *= 2;
+        } else {
+            memmove(bloque, p, pendientes);
+        }
+    }
+    free(bloque);
+    if (archivo != stdin) {
+        fclose(archivo);
+    }
+    return error ? -1 : agregados;
+}
+
+/*
+void contarPorGrupo(const AlmacenAlumnos *a, int especialidad, size_t *conteos)
+Recibe: el almacén, especialidad (identificador a filtrar, o -1 para todas) y conteos (un contador
+        por grupo, a->grupos.cantidad elementos)
+Devuelve: void (No retorna valor explícito)
+Observaciones: Sin filtro solo se lee la columna de grupos; con filtro, también la de especialidades.
+*/
+static inline void contarPorGrupo(const AlmacenAlumnos *a, int especialidad, size_t *conteos) {
+    memset(conteos, 0, a->grupos.cantidad * sizeof(size_t));
+    if (especialidad < 0) {
+        for (size_t i = 0; i < a->n; i++) {
+            conteos[a->grupo[i]]++;
+        }
+    } else {
+        uint16_t buscada = (uint16_t)especialidad;
+        for (size_t i = 0; i < a->n; i++) {
+            conteos[a->grupo[i]] += (a->especialidad[i] == buscada);
+        }
+    }
+}
+
+/*
+size_t filtrarAlumnos(const AlmacenAlumnos *a, int especialidad, int grupo, int matriculaMin, int matriculaMax,
+                      uint32_t *indices)
+Recibe: el almacén; especialidad y grupo (identificadores, o -1 para no filtrar); el rango de matrícula
+        [matriculaMin, matriculaMax]; indices (resultado, hasta a->n elementos)
+Devuelve: size_t (cantidad de alumnos que cumplen todos los filtros)
+Observaciones: Recorre solo las columnas de números; la condición se evalúa sin saltos y el índice se
+escribe siempre, avanzando la salida solo cuando el alumno cumple.
+*/
+static inline size_t filtrarAlumnos(const AlmacenAlumnos *a, int especialidad, int grupo, int matriculaMin,
+                                    int matriculaMax, uint32_t *indices) {
+    size_t k = 0;
+    for (size_t i = 0; i < a->n; i++) {
+        int cumple = (a->matricula[i] >= matriculaMin) & (a->matricula[i] <= matriculaMax) &
+                     ((especialidad < 0) | (a->especialidad[i] == especialidad)) &
+                     ((grupo < 0) | (a->grupo[i] == grupo));
+        indices[k] = (uint32_t)i;
+        k += (size_t)cumple;
+    }
+    return k;
+}
+
+/*
+int buscarEnDiccionario(const Diccionario *d, const char *texto)
+Recibe: const Diccionario *d, const char *texto
+Devuelve: int (identificador, o -1 si el texto no está)
+*/
+static inline int buscarEnDiccionario(const Diccionario *d, const char *texto) {
+    if (d->tamTabla == 0) {
+        return -1;
+    }
+    size_t lon = strlen(texto);
+    uint32_t h = hashTexto(texto, lon) & (d->tamTabla - 1);
+    while (d->tabla[h] != 0) {
+        if (strcmp(d->textos[d->tabla[h] - 1], texto) == 0) {
+            return (int)(d->tabla[h] - 1);
+        }
+        h = (h + 1) & (d->tamTabla - 1);
+    }
+    return -1;
+}
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef ORDEN_INDICES_H
+#define ORDEN_INDICES_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Práctica 04 - Ordenamiento por clave e índice
+
+Un Alumno ocupa 96 bytes y qsort (o cualquier ordenamiento por comparación) mueve el registro
+completo en cada intercambio. Aquí se ordena en su lugar un arreglo compacto de pares
+(clave de 64 bits, índice del registro) con Radix sort LSD, y el resultado es una permutación:
+permutacion[k] es el índice del registro que va en la posición k. Con ella se puede:
+  - recorrer los registros en orden sin moverlos (varias permutaciones pueden convivir: por
+    nombre, por matrícula, ...),
+  - copiarlos ya ordenados a otro arreglo (aplicarPermutacion), o
+  - reacomodarlos en su lugar moviendo cada registro una sola vez (aplicarPermutacionEnSitio).
+
+Claves:
+  - Enteros (matrícula): se invierte el bit de signo para que el orden sin signo sea el correcto.
+  - Cadenas (nombre): los primeros 8 bytes se empacan en un entero big-endian, que se ordena igual
+    que strcmp. Los pares que empatan en esos 8 bytes y cuyas cadenas siguen se vuelven a ordenar
+    con los 8 bytes siguientes, y así hasta distinguirlas o llegar al final del campo.
+Todo el proceso es estable: los empates conservan el orden original de los registros.
+
+Los registros se describen con base, tamaño del registro y desplazamiento del campo
+(offsetof), así que sirve para cualquier estructura.
+*/
+
+typedef struct {
+    uint64_t clave;
+    uint32_t indice;
+} ClaveIndice;
+
+// Tramos con menos pares que este se ordenan por Inserción en lugar de Radix sort
+#define UMBRAL_RADIX_CLAVES 64
+
+/*
+void insercionClaves(ClaveIndice *pares, size_t n)
+Recibe: ClaveIndice *pares, size_t n
+Devuelve: void (No retorna valor explícito)
+Observaciones: Inserción estable por clave, para tramos pequeños.
+*/
+static inline void insercionClaves(ClaveIndice *pares, size_t n) {
+    for (size_t k = 1; k < n; k++) {
+        ClaveIndice valor = pares[k];
+        size_t i = k;
+        while (i > 0 && pares[i - 1].clave > valor.clave) {
+            pares[i] = pares[i - 1];
+            i--;
+        }
+        pares[i] = valor;
+    }
+}
+
+/*
+int ordenarClaves(ClaveIndice *pares, size_t n)
+Recibe: ClaveIndice *pares (se ordenan por clave), size_t n
+Devuelve: int (1 si se ordenó, 0 si no hubo memoria para el arreglo auxiliar)
+Observaciones: Radix sort LSD de hasta 8 pasadas de 8 bits. Los histogramas de todas las pasadas
+se calculan en un solo recorrido, y las pasadas en las que todas las claves comparten el byte se
+omiten (una matrícula de 32 bits solo necesita 4).
+*/
+static inline int ordenarClaves(ClaveIndice *pares, size_t n) {
+    if (n < UMBRAL_RADIX_CLAVES) {
+        insercionClaves(pares, n);
+        return 1;
+    }
+    ClaveIndice *auxiliar = malloc(n * sizeof(ClaveIndice));
+    size_t (*conteo)[256] = calloc(8, sizeof(*conteo));
+    if (auxiliar == NULL || conteo == NULL) {
+        free(auxiliar);
+        free(conteo);
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        uint64_t clave = pares[i].clave;
+        for (int b = 0; b < 8; b++) {
+            conteo[b][(clave >> (8 * b)) & 0xFF]++;
+        }
+    }
+
+    ClaveIndice *origen = pares, *destino = auxiliar;
+    for (int b = 0; b < 8; b++) {
+        int corrimiento = 8 * b;
+        if (conteo[b][(origen[0].clave >> corrimiento) & 0xFF] == n) {
+            continue;   // Todas las claves tienen el mismo byte
+        }
+        size_t posicion = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t cuantos = conteo[b][d];
+            conteo[b][d] = posicion;
+            posicion += cuantos;
+        }
+        for (size_t i = 0; i < n; i++) {
+            destino[conteo[b][(origen[i].clave >> corrimiento) & 0xFF]++] = origen[i];
+        }
+        ClaveIndice *temp = origen;
+        origen = destino;
+        destino = temp;
+    }
+    if (origen != pares) {
+        memcpy(pares, origen, n * sizeof(ClaveIndice));
+    }
+    free(auxiliar);
+    free(conteo);
+    return 1;
+}
+
+/*
+uint64_t prefijoCadena(const char *cadena, size_t desde, size_t tamCampo)
+Recibe: const char *cadena (campo de tamCampo bytes), size_t desde (primer byte a empacar), size_t tamCampo
+Devuelve: uint64_t (bytes desde..desde+7 en orden big-endian, con ceros después del '\0')
+Observaciones: Comparar dos prefijos como enteros sin signo da el mismo orden que strcmp sobre esos bytes.
+*/
+static inline uint64_t prefijoCadena(const char *cadena, size_t desde, size_t tamCampo) {
+    uint64_t clave = 0;
+    int terminada = 0;
+    for (size_t i = desde; i < desde + 8; i++) {
+        unsigned char c = 0;
+        if (!terminada && i < tamCampo) {
+            c = (unsigned char)cadena[i];
+            terminada = (c == '\0');
+        }
+        clave = (clave << 8) | c;
+    }
+    return clave;
+}
+
+/*
+int ordenarPorCadenaDesde(ClaveIndice *pares, size_t n, const char *base, size_t tamRegistro,
+                          size_t desplazamiento, size_t tamCampo, size_t desde)
+Observaciones: Ordena los pares por los bytes desde.. del campo de texto; luego resuelve cada grupo de
+claves iguales cuyo último byte no sea '\0' (la cadena continúa) con los 8 bytes siguientes.
+*/
+static inline int ordenarPorCadenaDesde(ClaveIndice *pares, size_t n, const char *base, size_t tamRegistro,
+                                        size_t desplazamiento, size_t tamCampo, size_t desde) {
+    for (size_t i = 0; i < n; i++) {
+        pares[i].clave = prefijoCadena(base + pares[i].indice * tamRegistro + desplazamiento, desde, tamCampo);
+    }
+    if (!ordenarClaves(pares, n)) {
+        return 0;
+    }
+    if (desde + 8 >= tamCampo) {
+        return 1;
+    }
+    for (size_t ini = 0; ini < n; ) {
+        size_t fin = ini + 1;
+        while (fin < n && pares[fin].clave == pares[ini].clave) {
+            fin++;
+        }
+        if (fin - ini > 1 && (pares[ini].clave & 0xFF) != 0 &&
+            !ordenarPorCadenaDesde(pares + ini, fin - ini, base, tamRegistro, desplazamiento, tamCampo, desde + 8)) {
+            return 0;
+        }
+        ini = fin;
+    }
+    return 1;
+}
+
+/*
+int permutacionPorEntero(const void *registros, size_t n, size_t tamRegistro, size_t desplazamiento,
+                         uint32_t *permutacion)
+Recibe: const void *registros (arreglo de n registros de tamRegistro bytes), size_t desplazamiento
+        (offsetof del campo int), uint32_t *permutacion (resultado, n elementos)
+Devuelve: int (1 si se calculó, 0 si no hubo memoria)
+Observaciones: Los registros no se modifican.
+*/
+static inline int permutacionPorEntero(const void *registros, size_t n, size_t tamRegistro, size_t desplazamiento,
+                                       uint32_t *permutacion) {
+    ClaveIndice *pares = malloc((n > 0 ? n : 1) * sizeof(ClaveIndice));
+    if (pares == NULL) {
+        return 0;
+    }
+    const char *base = (const char *)registros;
+    for (size_t i = 0; i < n; i++) {
+        int valor;
+        memcpy(&valor, base + i * tamRegistro + desplazamiento, sizeof(int));
+        pares[i].clave = (uint32_t)valor ^ 0x80000000u;
+        pares[i].indice = (uint32_t)i;
+    }
+    int ok = ordenarClaves(pares, n);
+    for (size_t i = 0; ok && i < n; i++) {
+        permutacion[i] = pares[i].indice;
+    }
+    free(pares);
+    return ok;
+}
+
+/*
+int permutacionPorCadena(const void *registros, size_t n, size_t tamRegistro, size_t desplazamiento,
+                         size_t tamCampo, uint32_t *permutacion)
+Recibe: igual que permutacionPorEntero, más size_t tamCampo (tamaño del arreglo char del campo)
+Devuelve: int (1 si se calculó, 0 si no hubo memoria)
+Observaciones: Mismo orden que strcmp (bytes sin signo).
+*/
+static inline int permutacionPorCadena(const void *registros, size_t n, size_t tamRegistro, size_t desplazamiento,
+                                       size_t tamCampo, uint32_t *permutacion) {
+    ClaveIndice *pares = malloc((n > 0 ? n : 1) * sizeof(ClaveIndice));
+    if (pares == NULL) {
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        pares[i].indice = (uint32_t)i;
+    }
+    int ok = ordenarPorCadenaDesde(pares, n, (const char *)registros, tamRegistro, desplazamiento, tamCampo, 0);
+    for (size_t i = 0; ok && i < n; i++) {
+        permutacion[i] = pares[i].indice;
+    }
+    free(pares);
+    return ok;
+}
+
+/*
+void aplicarPermutacion(const void *registros, size_t n, size_t tamRegistro, const uint32_t *permutacion,
+                        void *destino)
+Recibe: registros de origen, n, tamRegistro, la permutación y destino (otro arreglo de n registros)
+Devuelve: void (No retorna valor explícito)
+Observaciones: destino[k] = registros[permutacion[k]]; cada registro se copia exactamente una vez.
+*/
+static inline void aplicarPermutacion(const void *registros, size_t n, size_t tamRegistro,
+                                      const uint32_t *permutacion, void *destino) {
+    const char *origen = (const char *)registros;
+    char *salida = (char *)destino;
+    for (size_t k = 0; k < n; k++) {
+        memcpy(salida + k * tamRegistro, origen + (size_t)permutacion[k] * tamRegistro, tamRegistro);
+    }
+}
+
+/*
+int aplicarPermutacionEnSitio(void *registros, size_t n, size_t tamRegistro, uint32_t *permutacion)
+Recibe: registros (se reacomodan), n, tamRegistro, permutacion (se usa como marca y se restaura)
+Devuelve: int (1 si se aplicó, 0 si no hubo memoria para el registro temporal)
+Observaciones: Sigue los ciclos de la permutación: cada registro se mueve una vez más un movimiento
+por ciclo hacia el temporal. El bit alto de cada entrada marca las posiciones ya colocadas, así que
+n debe ser menor que 2^31.
+*/
+static inline int aplicarPermutacionEnSitio(void *registros, size_t n, size_t tamRegistro, uint32_t *permutacion) {
+    const uint32_t colocado = 0x80000000u;
+    char *base = (char *)registros;
+    char *temporal = malloc(tamRegistro);
+    if (temporal == NULL) {
+        return 0;
+    }
+    for (size_t inicio = 0; inicio < n; inicio++) {
+        if (permutacion[inicio] & colocado) {
+            continue;
+        }
+        memcpy(temporal, base + inicio * tamRegistro, tamRegistro);
+        size_t actual = inicio;
+        size_t siguiente = permutacion[actual];
+        while (siguiente != inicio) {
+            memcpy(base + actual * tamRegistro, base + siguiente * tamRegistro, tamRegistro);
+            permutacion[actual] |= colocado;
+            actual = siguiente;
+            siguiente = permutacion[actual];
+        }
+        memcpy(base + actual * tamRegistro, temporal, tamRegistro);
+        permutacion[actual] |= colocado;
+    }
+    for (size_t i = 0; i < n; i++) {
+        permutacion[i] &= ~colocado;
+    }
+    free(temporal);
+    return 1;
+}
+
+#endif
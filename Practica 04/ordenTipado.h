@@ -0,0 +1,174 @@
+#ifndef ORDEN_TIPADO_H
+#define ORDEN_TIPADO_H
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+Práctica 04 - Ordenamiento especializado por tipo
+
+qsort recibe el comparador como void* y lo llama por apuntador en cada comparación, así que el
+compilador no puede integrarlo al ciclo de ordenamiento. DEFINIR_ORDEN genera, para un tipo de
+registro y un criterio concretos, funciones de ordenamiento donde la comparación es código
+normal que se integra (inline):
+
+    DEFINIR_ORDEN(Sufijo, Tipo, MENOR)
+        void ordenarSufijo(Tipo *arreglo, size_t n)          Introsort, O(n log n), no estable
+        int  ordenarEstableSufijo(Tipo *arreglo, size_t n)   Merge sort, O(n log n), estable;
+                                                             regresa 0 si no hubo memoria
+
+    MENOR(a, b) recibe dos const Tipo* y vale distinto de 0 si *a debe ir antes que *b. Puede ser
+    una macro o una función static inline.
+
+    DEFINIR_ORDEN_POR_CLAVE(Sufijo, Tipo, CLAVE) hace lo mismo comparando CLAVE(a) < CLAVE(b),
+    donde CLAVE(a) extrae de un const Tipo* un valor numérico (por ejemplo la matrícula).
+
+Para varios criterios (grupo y luego nombre) basta con un MENOR que compare el segundo campo
+cuando el primero empata, o con dos pasadas del ordenamiento estable (primero por nombre y
+luego por grupo).
+*/
+
+// Tramos con menos registros que este se ordenan por Inserción
+#define UMBRAL_ORDEN_TIPADO 16
+
+// Compara dos valores numéricos sin restarlos (la resta puede desbordarse): -1, 0 o 1
+#define COMPARAR_NUMEROS(x, y) (((x) > (y)) - ((x) < (y)))
+
+#define DEFINIR_ORDEN(SUFIJO, TIPO, MENOR)                                                         \
+                                                                                                   \
+/* Inserción estable: solo recorre a la izquierda mientras el registro sea estrictamente menor */  \
+static inline void insercion##SUFIJO(TIPO *arreglo, size_t n) {                                    \
+    for (size_t k = 1; k < n; k++) {                                                               \
+        TIPO valor = arreglo[k];                                                                   \
+        size_t i = k;                                                                              \
+        while (i > 0 && MENOR(&valor, &arreglo[i - 1])) {                                          \
+            arreglo[i] = arreglo[i - 1];                                                           \
+            i--;                                                                                   \
+        }                                                                                          \
+        arreglo[i] = valor;                                                                        \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline void hundir##SUFIJO(TIPO *arreglo, size_t i, size_t n) {                             \
+    TIPO valor = arreglo[i];                                                                       \
+    size_t hijo;                                                                                   \
+    while ((hijo = 2 * i + 1) < n) {                                                               \
+        if (hijo + 1 < n && MENOR(&arreglo[hijo], &arreglo[hijo + 1])) {                           \
+            hijo++;                                                                                \
+        }                                                                                          \
+        if (!MENOR(&valor, &arreglo[hijo])) {                                                      \
+            break;                                                                                 \
+        }                                                                                          \
+        arreglo[i] = arreglo[hijo];                                                                \
+        i = hijo;                                                                                  \
+    }                                                                                              \
+    arreglo[i] = valor;                                                                            \
+}                                                                                                  \
+                                                                                                   \
+static inline void monticulo##SUFIJO(TIPO *arreglo, size_t n) {                                    \
+    for (size_t i = n / 2; i-- > 0; ) {                                                            \
+        hundir##SUFIJO(arreglo, i, n);                                                             \
+    }                                                                                              \
+    for (size_t fin = n; fin-- > 1; ) {                                                            \
+        TIPO temp = arreglo[0];                                                                    \
+        arreglo[0] = arreglo[fin];                                                                 \
+        arreglo[fin] = temp;                                                                       \
+        hundir##SUFIJO(arreglo, 0, fin);                                                           \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+/* Igual que introsortRec de la Práctica 01: deja sin ordenar los tramos pequeños */               \
+static inline void introsort##SUFIJO(TIPO *arreglo, size_t n, int profundidad) {                   \
+    while (n > UMBRAL_ORDEN_TIPADO) {                                                              \
+        if (profundidad == 0) {                                                                    \
+            monticulo##SUFIJO(arreglo, n);                                                         \
+            return;                                                                                \
+        }                                                                                          \
+        profundidad--;                                                                             \
+                                                                                                   \
+        /* Mediana de tres como pivote (se copia: la partición mueve los registros) */             \
+        const TIPO *a = &arreglo[0], *b = &arreglo[n / 2], *c = &arreglo[n - 1];                   \
+        const TIPO *m = MENOR(a, b) ? (MENOR(b, c) ? b : (MENOR(a, c) ? c : a))                    \
+                                    : (MENOR(a, c) ? a : (MENOR(b, c) ? c : b));                   \
+        TIPO pivote = *m;                                                                          \
+                                                                                                   \
+        /* Partición de Hoare */                                                                   \
+        size_t i = (size_t)-1, j = n;                                                              \
+        for (;;) {                                                                                 \
+            do { i++; } while (MENOR(&arreglo[i], &pivote));                                       \
+            do { j--; } while (MENOR(&pivote, &arreglo[j]));                                       \
+            if (i >= j) {                                                                          \
+                break;                                                                             \
+            }                                                                                      \
+            TIPO temp = arreglo[i];                                                                \
+            arreglo[i] = arreglo[j];                                                               \
+            arreglo[j] = temp;                                                                     \
+        }                                                                                          \
+                                                                                                   \
+        size_t izq = j + 1;                                                                        \
+        if (izq < n - izq) {                                                                       \
+            introsort##SUFIJO(arreglo, izq, profundidad);                                          \
+            arreglo += izq;                                                                        \
+            n -= izq;                                                                              \
+        } else {                                                                                   \
+            introsort##SUFIJO(arreglo + izq, n - izq, profundidad);                                \
+            n = izq;                                                                               \
+        }                                                                                          \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline void ordenar##SUFIJO(TIPO *arreglo, size_t n) {                                      \
+    int profundidad = 0;                                                                           \
+    for (size_t m = n; m > 1; m >>= 1) {                                                           \
+        profundidad += 2;                                                                          \
+    }                                                                                              \
+    introsort##SUFIJO(arreglo, n, profundidad);                                                    \
+    insercion##SUFIJO(arreglo, n);                                                                 \
+}                                                                                                  \
+                                                                                                   \
+/* Merge sort de arriba hacia abajo; a igualdad se toma primero el registro de la izquierda */     \
+static inline void mezcla##SUFIJO(TIPO *arreglo, TIPO *auxiliar, size_t n) {                       \
+    if (n <= UMBRAL_ORDEN_TIPADO) {                                                                \
+        insercion##SUFIJO(arreglo, n);                                                             \
+        return;                                                                                    \
+    }                                                                                              \
+    size_t mitad = n / 2;                                                                          \
+    mezcla##SUFIJO(arreglo, auxiliar, mitad);                                                      \
+    mezcla##SUFIJO(arreglo + mitad, auxiliar, n - mitad);                                          \
+    if (!MENOR(&arreglo[mitad], &arreglo[mitad - 1])) {                                            \
+        return; /* Las mitades ya quedaron en orden */                                             \
+    }                                                                                              \
+    memcpy(auxiliar, arreglo, mitad * sizeof(TIPO));                                               \
+    size_t i = 0, j = mitad, k = 0;                                                                \
+    while (i < mitad && j < n) {                                                                   \
+        if (MENOR(&arreglo[j], &auxiliar[i])) {                                                    \
+            arreglo[k++] = arreglo[j++];                                                           \
+        } else {                                                                                   \
+            arreglo[k++] = auxiliar[i++];                                                          \
+        }                                                                                          \
+    }                                                                                              \
+    while (i < mitad) {                                                                            \
+        arreglo[k++] = auxiliar[i++];                                                              \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline int ordenarEstable##SUFIJO(TIPO *arreglo, size_t n) {                                \
+    if (n < 2) {                                                                                   \
+        return 1;                                                                                  \
+    }                                                                                              \
+    TIPO *auxiliar = malloc((n / 2) * sizeof(TIPO));                                               \
+    if (auxiliar == NULL) {                                                                        \
+        return 0;                                                                                  \
+    }                                                                                              \
+    mezcla##SUFIJO(arreglo, auxiliar, n);                                                          \
+    free(auxiliar);                                                                                \
+    return 1;                                                                                      \
+}
+
+#define DEFINIR_ORDEN_POR_CLAVE(SUFIJO, TIPO, CLAVE)                                               \
+static inline int menor##SUFIJO(const TIPO *a, const TIPO *b) {                                    \
+    return CLAVE(a) < CLAVE(b);                                                                    \
+}                                                                                                  \
+DEFINIR_ORDEN(SUFIJO, TIPO, menor##SUFIJO)
+
+#endif
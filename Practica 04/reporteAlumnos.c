@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "almacenAlumnos.h"
+#include "ordenIndices.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
+
+// Reporte de listas de alumnos grandes sobre el almacén columnar (almacenAlumnos.h)
+//
+// Compilación: gcc reporteAlumnos.c -o reporte
+// Ejecución:   ./reporte --generar {n} > lista.csv          Genera una lista de n alumnos al azar
+//              ./reporte --entrada lista.csv                Alumnos por grupo
+//              ./reporte --entrada lista.csv --especialidad Datos --primeros 10
+//
+// Opciones:    --entrada {archivo}        CSV nombre,especialidad,matricula,grupo (por defecto, la entrada estándar)
+//              --especialidad {nombre}    Cuenta por grupo solo los alumnos de esa especialidad
+//              --grupo {grupo}            Junto con --especialidad, cuántos alumnos cumplen ambos filtros
+//              --primeros {k}             Muestra los k alumnos (de los filtrados) con menor matrícula
+
+// Escribe n alumnos al azar en formato CSV, con los mismos nombres y grupos que script.c
+void generarCSV(long long n, unsigned long long semilla) {
+    static const char *nombres[] = {"Ana", "Carlos", "Elena", "Jorge", "Laura", "Luis", "Maria", "Pedro",
+                                    "Roberto", "Sofia"};
+    static const char *apellidos[] = {"Diaz", "Fernandez", "Gonzalez", "Hernandez", "Lopez", "Martinez",
+                                      "Ramirez", "Ruiz", "Sanchez", "Torres"};
+    static const char *especialidades[] = {"Computacion", "Sistemas", "Datos"};
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    printf("nombre,especialidad,matricula,grupo\n");
+    for (long long i = 0; i < n; i++) {
+        printf("%s %s %u,%s,%d,%uCM%u\n", nombres[generadorRango(&g, 10)], apellidos[generadorRango(&g, 10)],
+               generadorRango(&g, 100000), especialidades[generadorRango(&g, 3)],
+               2000000000 + (int)generadorRango(&g, 147483647), 1 + generadorRango(&g, 4), 1 + generadorRango(&g, 9));
+    }
+}
+
+int compararTextos(const void *a, const void *b) {
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+int main(int num_arg, char *arg_user[]) {
+    const char *rutaEntrada = NULL;
+    const char *nombreEspecialidad = NULL;
+    const char *nombreGrupo = NULL;
+    long long generar = -1;
+    int primeros = 0;
+    for (int i = 1; i < num_arg; i++) {
+        if (strcmp(arg_user[i], "--entrada") == 0 && i + 1 < num_arg) {
+            rutaEntrada = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--especialidad") == 0 && i + 1 < num_arg) {
+            nombreEspecialidad = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--grupo") == 0 && i + 1 < num_arg) {
+            nombreGrupo = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--primeros") == 0 && i + 1 < num_arg) {
+            primeros = atoi(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--generar") == 0 && i + 1 < num_arg) {
+            generar = atoll(arg_user[++i]);
+        } else {
+            printf("Opcion no reconocida: %s\n", arg_user[i]);
+            exit(1);
+        }
+    }
+
+    if (generar >= 0) {
+        generarCSV(generar, 1);
+        return 0;
+    }
+
+    AlmacenAlumnos almacen;
+    almacenIniciar(&almacen);
+    double t = tiempoMonotonico();
+    long long cargados = almacenCargarCSV(&almacen, rutaEntrada);
+    t = tiempoMonotonico() - t;
+    if (cargados < 0) {
+        printf("Error: No se pudo leer la lista de alumnos (archivo o memoria)\n");
+        exit(1);
+    }
+    printf("Alumnos cargados: %lld en %f segundos (%u grupos, %u especialidades)\n", cargados, t,
+           almacen.grupos.cantidad, almacen.especialidades.cantidad);
+
+    // Los filtros se traducen una sola vez a identificadores; un nombre que no existe no coincide con nadie
+    int especialidad = -1, grupo = -1;
+    int sinCoincidencias = 0;
+    if (nombreEspecialidad != NULL) {
+        especialidad = buscarEnDiccionario(&almacen.especialidades, nombreEspecialidad);
+        sinCoincidencias |= (especialidad < 0);
+    }
+    if (nombreGrupo != NULL) {
+        grupo = buscarEnDiccionario(&almacen.grupos, nombreGrupo);
+        sinCoincidencias |= (grupo < 0);
+    }
+
+    // Conteo por grupo: solo lee la columna de grupos (y la de especialidades si se filtra)
+    size_t *conteos = malloc((almacen.grupos.cantidad + 1) * sizeof(size_t));
+    const char **grupos = malloc((almacen.grupos.cantidad + 1) * sizeof(char *));
+    uint32_t *indices = malloc((almacen.n + 1) * sizeof(uint32_t));
+    if (conteos == NULL || grupos == NULL || indices == NULL) {
+        printf("Error: No se pudo asignar memoria\n");
+        exit(1);
+    }
+    t = tiempoMonotonico();
+    contarPorGrupo(&almacen, sinCoincidencias ? 0 : especialidad, conteos);
+    t = tiempoMonotonico() - t;
+    if (sinCoincidencias) {
+        memset(conteos, 0, almacen.grupos.cantidad * sizeof(size_t));
+    }
+
+    printf("\n=== Alumnos por grupo%s%s ===\n", nombreEspecialidad ? " de " : "",
+           nombreEspecialidad ? nombreEspecialidad : "");
+    for (uint32_t g = 0; g < almacen.grupos.cantidad; g++) {
+        grupos[g] = almacen.grupos.textos[g];
+    }
+    qsort(grupos, almacen.grupos.cantidad, sizeof(char *), compararTextos);
+    for (uint32_t g = 0; g < almacen.grupos.cantidad; g++) {
+        printf("%-10s %zu\n", grupos[g], conteos[buscarEnDiccionario(&almacen.grupos, grupos[g])]);
+    }
+    printf("(conteo: %f segundos)\n", t);
+
+    // Filtro por especialidad y grupo sobre todas las matrículas
+    t = tiempoMonotonico();
+    size_t filtrados = sinCoincidencias ? 0
+                                        : filtrarAlumnos(&almacen, especialidad, grupo, -2147483647 - 1, 2147483647,
+                                                         indices);
+    t = tiempoMonotonico() - t;
+    printf("\nAlumnos que cumplen los filtros: %zu (%f segundos)\n", filtrados, t);
+
+    if (primeros > 0 && filtrados > 0) {
+        // Se ordena solo la columna de matrículas de los filtrados; los nombres se consultan al final
+        int *matriculas = malloc(filtrados * sizeof(int));
+        uint32_t *permutacion = malloc(filtrados * sizeof(uint32_t));
+        if (matriculas == NULL || permutacion == NULL) {
+            printf("Error: No se pudo asignar memoria\n");
+            exit(1);
+        }
+        for (size_t k = 0; k < filtrados; k++) {
+            matriculas[k] = almacen.matricula[indices[k]];
+        }
+        t = tiempoMonotonico();
+        int ok = permutacionPorEntero(matriculas, filtrados, sizeof(int), 0, permutacion);
+        t = tiempoMonotonico() - t;
+        if (!ok) {
+            printf("Error: No se pudo asignar memoria\n");
+            exit(1);
+        }
+        printf("\n=== %d primeros por matricula (orden: %f segundos) ===\n", primeros, t);
+        for (size_t k = 0; k < filtrados && k < (size_t)primeros; k++) {
+            size_t i = indices[permutacion[k]];
+            printf("%s - %s - %d - %s\n", almacenNombre(&almacen, i),
+                   almacen.especialidades.textos[almacen.especialidad[i]], almacen.matricula[i],
+                   almacen.grupos.textos[almacen.grupo[i]]);
+        }
+        free(matriculas);
+        free(permutacion);
+    }
+
+    free(conteos);
+    free(grupos);
+    free(indices);
+    almacenLiberar(&almacen);
+    return 0;
+}
@@ -1,6 +1,16 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
+#include "ordenTipado.h"
+#include "ordenIndices.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
+
+// Compilación: gcc script.c -o script
+// Ejecución:   ./script            Ordena la lista de ejemplo por nombre, por matrícula y por grupo y nombre
+//              ./script {n}        Además compara qsort contra los ordenamientos tipados y por índices
+//                                  con n alumnos generados
 
 // Definición de la estructura Alumno
 typedef struct {
@@ -26,10 +36,31 @@ int compararPorMatricula(const void *a, const void *b) {
     Alumno *alumnoA = (Alumno *)a;
     Alumno *alumnoB = (Alumno *)b;
     
-    // Comparación numérica directa
-    return alumnoA->matricula - alumnoB->matricula;
+    // Comparación numérica sin restar: matricula A - matricula B se desborda con signos opuestos
+    return COMPARAR_NUMEROS(alumnoA->matricula, alumnoB->matricula);
+}
+
+// Función comparadora para ordenar por grupo y, dentro de cada grupo, por nombre
+int compararPorGrupoYNombre(const void *a, const void *b) {
+    Alumno *alumnoA = (Alumno *)a;
+    Alumno *alumnoB = (Alumno *)b;
+
+    int porGrupo = strcmp(alumnoA->grupo, alumnoB->grupo);
+    return porGrupo != 0 ? porGrupo : strcmp(alumnoA->nombre, alumnoB->nombre);
 }
 
+// Criterios para los ordenamientos tipados: reciben const Alumno* y dicen si a va antes que b
+#define MATRICULA_ALUMNO(a) ((a)->matricula)
+#define MENOR_POR_NOMBRE(a, b) (strcmp((a)->nombre, (b)->nombre) < 0)
+#define MENOR_POR_GRUPO(a, b) (strcmp((a)->grupo, (b)->grupo) < 0)
+#define MENOR_POR_GRUPO_Y_NOMBRE(a, b) (compararPorGrupoYNombre((a), (b)) < 0)
+
+// ordenarAlumnosPorMatricula, ordenarAlumnosPorNombre, ordenarEstableAlumnosPorGrupo, ...
+DEFINIR_ORDEN_POR_CLAVE(AlumnosPorMatricula, Alumno, MATRICULA_ALUMNO)
+DEFINIR_ORDEN(AlumnosPorNombre, Alumno, MENOR_POR_NOMBRE)
+DEFINIR_ORDEN(AlumnosPorGrupo, Alumno, MENOR_POR_GRUPO)
+DEFINIR_ORDEN(AlumnosPorGrupoYNombre, Alumno, MENOR_POR_GRUPO_Y_NOMBRE)
+
 // Función para imprimir el arreglo de alumnos
 void imprimirAlumnos(Alumno alumnos[], int n) {
     for (int i = 0; i < n; i++) {
@@ -41,7 +72,85 @@ void imprimirAlumnos(Alumno alumnos[], int n) {
     }
 }
 
-int main() {
+// Genera n alumnos con nombres, grupos y matrículas al azar para medir los ordenamientos
+void generarAlumnos(Alumno alumnos[], int n, unsigned long long semilla) {
+    static const char *nombres[] = {"Ana", "Carlos", "Elena", "Jorge", "Laura", "Luis", "Maria", "Pedro",
+                                    "Roberto", "Sofia"};
+    static const char *apellidos[] = {"Diaz", "Fernandez", "Gonzalez", "Hernandez", "Lopez", "Martinez",
+                                      "Ramirez", "Ruiz", "Sanchez", "Torres"};
+    static const char *especialidades[] = {"Computacion", "Sistemas", "Datos"};
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    for (int i = 0; i < n; i++) {
+        snprintf(alumnos[i].nombre, sizeof(alumnos[i].nombre), "%s %s %u", nombres[generadorRango(&g, 10)],
+                 apellidos[generadorRango(&g, 10)], generadorRango(&g, 100000));
+        strcpy(alumnos[i].especialidad, especialidades[generadorRango(&g, 3)]);
+        alumnos[i].matricula = 2000000000 + (int)generadorRango(&g, 147483647);
+        snprintf(alumnos[i].grupo, sizeof(alumnos[i].grupo), "%uCM%u", 1 + generadorRango(&g, 4),
+                 1 + generadorRango(&g, 9));
+    }
+}
+
+// Ordena una copia de los alumnos con qsort y otra con el ordenamiento tipado, y compara tiempos y resultado
+void compararOrdenamientos(const char *criterio, const Alumno original[], Alumno copia[], Alumno referencia[],
+                           int n, int (*comparar)(const void *, const void *), void (*ordenar)(Alumno *, size_t)) {
+    memcpy(referencia, original, n * sizeof(Alumno));
+    double t = tiempoMonotonico();
+    qsort(referencia, n, sizeof(Alumno), comparar);
+    double tQsort = tiempoMonotonico() - t;
+
+    memcpy(copia, original, n * sizeof(Alumno));
+    t = tiempoMonotonico();
+    ordenar(copia, n);
+    double tTipado = tiempoMonotonico() - t;
+
+    // Con claves repetidas el orden de los empates puede variar, así que se compara solo la clave
+    int iguales = 1;
+    for (int i = 0; i < n && iguales; i++) {
+        iguales = comparar(&copia[i], &referencia[i]) == 0;
+    }
+    printf("%-16s qsort: %f s   tipado: %f s   (%.2fx) %s\n", criterio, tQsort, tTipado, tQsort / tTipado,
+           iguales ? "" : "RESULTADO DISTINTO");
+}
+
+// Ordenamientos por clave e índice: calculan la permutación y mueven cada registro una sola vez
+void ordenarPorIndiceMatricula(Alumno *alumnos, size_t n) {
+    uint32_t *permutacion = malloc((n > 0 ? n : 1) * sizeof(uint32_t));
+    if (permutacion == NULL ||
+        !permutacionPorEntero(alumnos, n, sizeof(Alumno), offsetof(Alumno, matricula), permutacion) ||
+        !aplicarPermutacionEnSitio(alumnos, n, sizeof(Alumno), permutacion)) {
+        ordenarAlumnosPorMatricula(alumnos, n);
+    }
+    free(permutacion);
+}
+
+void ordenarPorIndiceNombre(Alumno *alumnos, size_t n) {
+    uint32_t *permutacion = malloc((n > 0 ? n : 1) * sizeof(uint32_t));
+    if (permutacion == NULL ||
+        !permutacionPorCadena(alumnos, n, sizeof(Alumno), offsetof(Alumno, nombre), sizeof(alumnos->nombre),
+                              permutacion) ||
+        !aplicarPermutacionEnSitio(alumnos, n, sizeof(Alumno), permutacion)) {
+        ordenarAlumnosPorNombre(alumnos, n);
+    }
+    free(permutacion);
+}
+
+// Imprime los alumnos en el orden de la permutación, sin moverlos
+void imprimirAlumnosPermutados(const Alumno alumnos[], const uint32_t permutacion[], int n) {
+    for (int k = 0; k < n; k++) {
+        const Alumno *a = &alumnos[permutacion[k]];
+        printf("%s - %s - %d - %s\n", a->nombre, a->especialidad, a->matricula, a->grupo);
+    }
+}
+
+void ordenarEstablePorGrupoYNombre(Alumno *alumnos, size_t n) {
+    // Dos pasadas estables: primero por nombre, luego por grupo (los empates de grupo conservan el nombre)
+    if (!ordenarEstableAlumnosPorNombre(alumnos, n) || !ordenarEstableAlumnosPorGrupo(alumnos, n)) {
+        ordenarAlumnosPorGrupoYNombre(alumnos, n);
+    }
+}
+
+int main(int argc, char *argv[]) {
     // Declaración e inicialización del arreglo de alumnos
     Alumno alumnos[] = {
         {"Carlos Ramirez", "Computacion", 2021630045, "3CM1"},
@@ -60,13 +169,64 @@ int main() {
     
     // Ordenamiento por nombre
     printf("=== Ordenamiento por Nombre ===\n");
-    qsort(alumnos, n, sizeof(Alumno), compararPorNombre);
+    ordenarAlumnosPorNombre(alumnos, n);
     imprimirAlumnos(alumnos, n);
     
     // Ordenamiento por matrícula
     printf("\n=== Ordenamiento por Matricula ===\n");
-    qsort(alumnos, n, sizeof(Alumno), compararPorMatricula);
+    ordenarAlumnosPorMatricula(alumnos, n);
+    imprimirAlumnos(alumnos, n);
+
+    // Ordenamiento por grupo y nombre (estable: dos pasadas)
+    printf("\n=== Ordenamiento por Grupo y Nombre ===\n");
+    ordenarEstablePorGrupoYNombre(alumnos, n);
     imprimirAlumnos(alumnos, n);
+
+    // Dos órdenes que conviven sobre los mismos registros, sin copiarlos
+    uint32_t porNombre[sizeof(alumnos) / sizeof(alumnos[0])], porMatricula[sizeof(alumnos) / sizeof(alumnos[0])];
+    if (permutacionPorCadena(alumnos, n, sizeof(Alumno), offsetof(Alumno, nombre), sizeof(alumnos[0].nombre),
+                             porNombre) &&
+        permutacionPorEntero(alumnos, n, sizeof(Alumno), offsetof(Alumno, matricula), porMatricula)) {
+        printf("\n=== Permutacion por Nombre (sin mover registros) ===\n");
+        imprimirAlumnosPermutados(alumnos, porNombre, n);
+        printf("\n=== Permutacion por Matricula (sin mover registros) ===\n");
+        imprimirAlumnosPermutados(alumnos, porMatricula, n);
+    }
+
+    if (argc > 1) {
+        int total = atoi(argv[1]);
+        if (total <= 0) {
+            printf("Error: la cantidad de alumnos debe ser positiva\n");
+            return 1;
+        }
+        Alumno *original = malloc(total * sizeof(Alumno));
+        Alumno *copia = malloc(total * sizeof(Alumno));
+        Alumno *referencia = malloc(total * sizeof(Alumno));
+        if (original == NULL || copia == NULL || referencia == NULL) {
+            printf("Error: No se pudo asignar memoria\n");
+            return 1;
+        }
+        generarAlumnos(original, total, 1);
+
+        printf("\n=== qsort contra ordenamiento tipado con %d alumnos ===\n", total);
+        compararOrdenamientos("matricula", original, copia, referencia, total, compararPorMatricula,
+                              ordenarAlumnosPorMatricula);
+        compararOrdenamientos("matricula (idx)", original, copia, referencia, total, compararPorMatricula,
+                              ordenarPorIndiceMatricula);
+        compararOrdenamientos("nombre", original, copia, referencia, total, compararPorNombre,
+                              ordenarAlumnosPorNombre);
+        compararOrdenamientos("nombre (idx)", original, copia, referencia, total, compararPorNombre,
+                              ordenarPorIndiceNombre);
+        compararOrdenamientos("grupo y nombre", original, copia, referencia, total, compararPorGrupoYNombre,
+                              ordenarAlumnosPorGrupoYNombre);
+        compararOrdenamientos("grupo y nombre*", original, copia, referencia, total, compararPorGrupoYNombre,
+                              ordenarEstablePorGrupoYNombre);
+        printf("* estable, dos pasadas; (idx): por clave e indice, cada registro se mueve una vez\n");
+
+        free(original);
+        free(copia);
+        free(referencia);
+    }
     
     return 0;
 }
@@ -0,0 +1,307 @@
+#ifndef DUPLICADOS_H
+#define DUPLICADOS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DUPLICADOS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Biblioteca de búsqueda del elemento duplicado
+ *
+ * Generaliza el problema de numDobles.c: el arreglo contiene enteros consecutivos a partir de
+ * arr[0] (en la práctica, 1..n-1) con exactamente un valor repetido. Antes del duplicado se
+ * cumple arr[i] - arr[0] == i y a partir de la segunda copia arr[i] - arr[0] == i - 1, así que
+ * la pregunta "¿ya pasé el duplicado en i?" es monótona y basta con buscar la primera posición
+ * donde se cumple.
+ *
+ * Estrategias:
+ * - BUSQUEDA_SECUENCIAL: la de busquedaSecuencial, O(n); sirve como referencia.
+ * - BUSQUEDA_BINARIA: iterativa y sin saltos dependientes de los datos: en cada paso el
+ *   inicio del rango se actualiza con una selección (cmov) en lugar de un if, así que el
+ *   procesador nunca falla una predicción. Hace siempre ceil(log2 n) + 1 comparaciones.
+ * - BUSQUEDA_GALOPE: revisa las posiciones 1, 3, 7, 15, ... hasta pasar el duplicado y luego
+ *   hace la búsqueda binaria solo en el último tramo: O(log d) si el duplicado está en la
+ *   posición d, mejor que la binaria cuando suele estar cerca del inicio.
+ *
+ * Las consultas en lote (resolverConsultas) avanzan varias búsquedas binarias a la vez para que
+ * los accesos a memoria de unas se traslapen con los de otras, y cada consulta reporta cuántas
+ * comparaciones hizo. Los arreglos muy grandes pueden leerse de un archivo binario ".i32"
+ * mapeado en memoria (abrirArregloMapeado) sin copiarlos.
+ */
+
+typedef enum {
+    BUSQUEDA_SECUENCIAL,
+    BUSQUEDA_BINARIA,
+    BUSQUEDA_GALOPE
+} EstrategiaDuplicado;
+
+static const char *const NOMBRES_ESTRATEGIA_DUPLICADO[] = {"secuencial", "binaria", "galope"};
+
+typedef struct {
+    const int *arreglo;         // Entrada: arreglo de la consulta
+    size_t n;                   // Entrada: número de elementos
+    int duplicado;              // Salida: valor repetido, o -1 si no hay
+    long long comparaciones;    // Salida: comparaciones hechas por la consulta
+} ConsultaDuplicado;
+
+// Búsquedas que avanzan juntas en resolverConsultas
+#define GRUPO_CONSULTAS 8
+
+// Pide al procesador una posición que probablemente se lea pronto (sin efecto fuera de GCC/Clang)
+#if defined(__GNUC__)
+#define ADELANTAR_LECTURA(p) __builtin_prefetch(p)
+#else
+#define ADELANTAR_LECTURA(p) ((void)0)
+#endif
+
+/**
+ * Verdadero si arr[0..i] todavía no contiene el duplicado.
+ * Se resta en long long para que valores cercanos a los límites de int no se desborden.
+ */
+static inline int sinDuplicadoHasta(const int *arr, size_t i) {
+    return (long long)arr[i] - arr[0] == (long long)i;
+}
+
+/**
+ * Búsqueda secuencial
+ * Compara cada elemento con el siguiente, como busquedaSecuencial.
+ * Devuelve el valor repetido (o -1) y suma a *comparaciones las comparaciones hechas.
+ */
+static inline int duplicadoSecuencial(const int *arr, size_t n, long long *comparaciones) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        if (arr[i] == arr[i + 1]) {
+            *comparaciones += (long long)i + 1;
+            return arr[i];
+        }
+    }
+    *comparaciones += n > 0 ? (long long)n - 1 : 0;
+    return -1;
+}
+
+/**
+ * Búsqueda binaria sin saltos sobre [base, base + len]
+ * Invariante: la primera posición con el duplicado ya pasado está en [base, base + len].
+ * Cada vuelta descarta la mitad del rango eligiendo el nuevo inicio con una expresión
+ * condicional que el compilador traduce a cmov; el ciclo solo depende de len, no de los datos.
+ * Para arreglos grandes se adelanta la lectura de las dos posiciones que podrían revisarse
+ * en la vuelta siguiente.
+ */
+static inline size_t primeraPosicionSinOrden(const int *arr, size_t base, size_t len, long long *comparaciones) {
+    long long cuenta = 1;
+    while (len > 1) {
+        size_t mitad = len / 2;
+        ADELANTAR_LECTURA(&arr[base + mitad / 2]);
+        ADELANTAR_LECTURA(&arr[base + mitad + mitad / 2]);
+        base = sinDuplicadoHasta(arr, base + mitad) ? base + mitad : base;
+        len -= mitad;
+        cuenta++;
+    }
+    *comparaciones += cuenta;
+    return base + (size_t)sinDuplicadoHasta(arr, base);
+}
+
+/**
+ * Búsqueda binaria iterativa
+ * Sustituye a busquedaBinariaMod: sin recursión y con una sola comparación por nivel.
+ * Devuelve el valor repetido (o -1 si el arreglo no tiene duplicado).
+ */
+static inline int duplicadoBinaria(const int *arr, size_t n, long long *comparaciones) {
+    if (n < 2) {
+        return -1;
+    }
+    // El resultado está en [0, n]; n significa que no hay duplicado
+    size_t pos = primeraPosicionSinOrden(arr, 0, n, comparaciones);
+    return pos < n ? arr[pos] : -1;
+}
+
+/**
+ * Búsqueda por galope (exponencial)
+ * Revisa las posiciones 2^k - 1 hasta encontrar una donde ya pasó el duplicado y termina con la
+ * búsqueda binaria entre la última posición sin duplicado y esa.
+ * - Mejor caso: O(1) - el duplicado está al inicio
+ * - Peor caso: O(log n) - unas 2 log2(n) comparaciones, el doble que la binaria
+ */
+static inline int duplicadoGalope(const int *arr, size_t n, long long *comparaciones) {
+    if (n < 2) {
+        return -1;
+    }
+    size_t anterior = 0, salto = 1;
+    while (salto < n && sinDuplicadoHasta(arr, salto)) {
+        (*comparaciones)++;
+        anterior = salto;
+        salto = 2 * salto + 1;
+    }
+    *comparaciones += (salto < n);   // La comparación que detuvo el galope
+    size_t hasta = salto < n ? salto : n;
+    size_t pos = primeraPosicionSinOrden(arr, anterior, hasta - anterior, comparaciones);
+    return pos < n ? arr[pos] : -1;
+}
+
+/**
+ * Resuelve una consulta con la estrategia indicada
+ */
+static inline void resolverConsulta(ConsultaDuplicado *c, EstrategiaDuplicado estrategia) {
+    c->comparaciones = 0;
+    switch (estrategia) {
+    case BUSQUEDA_SECUENCIAL:
+        c->duplicado = duplicadoSecuencial(c->arreglo, c->n, &c->comparaciones);
+        break;
+    case BUSQUEDA_GALOPE:
+        c->duplicado = duplicadoGalope(c->arreglo, c->n, &c->comparaciones);
+        break;
+    default:
+        c->duplicado = duplicadoBinaria(c->arreglo, c->n, &c->comparaciones);
+        break;
+    }
+}
+
+/**
+ * Consultas en lote
+ * Con BUSQUEDA_BINARIA las consultas se resuelven en grupos de GRUPO_CONSULTAS que avanzan un
+ * nivel a la vez: mientras se espera la lectura de una, el procesador ya pidió las de las demás.
+ * Las otras estrategias se resuelven una por una.
+ */
+static inline void resolverConsultas(ConsultaDuplicado *consultas, size_t cantidad, EstrategiaDuplicado estrategia) {
+    if (estrategia != BUSQUEDA_BINARIA) {
+        for (size_t q = 0; q < cantidad; q++) {
+            resolverConsulta(&consultas[q], estrategia);
+        }
+        return;
+    }
+    for (size_t g = 0; g < cantidad; g += GRUPO_CONSULTAS) {
+        size_t k = cantidad - g < GRUPO_CONSULTAS ? cantidad - g : GRUPO_CONSULTAS;
+        ConsultaDuplicado *c = consultas + g;
+        size_t base[GRUPO_CONSULTAS], len[GRUPO_CONSULTAS];
+        int activas = 0;
+        for (size_t j = 0; j < k; j++) {
+            base[j] = 0;
+            len[j] = c[j].n;
+            c[j].comparaciones = 0;
+            activas |= len[j] > 1;
+        }
+        while (activas) {
+            activas = 0;
+            for (size_t j = 0; j < k; j++) {
+                if (len[j] > 1) {
+                    size_t mitad = len[j] / 2;
+                    ADELANTAR_LECTURA(&c[j].arreglo[base[j] + mitad / 2]);
+                    ADELANTAR_LECTURA(&c[j].arreglo[base[j] + mitad + mitad / 2]);
+                    base[j] = sinDuplicadoHasta(c[j].arreglo, base[j] + mitad) ? base[j] + mitad : base[j];
+                    len[j] -= mitad;
+                    c[j].comparaciones++;
+                    activas |= len[j] > 1;
+                }
+            }
+        }
+        for (size_t j = 0; j < k; j++) {
+            if (c[j].n < 2) {
+                c[j].duplicado = -1;
+                continue;
+            }
+            c[j].comparaciones++;
+            size_t pos = base[j] + (size_t)sinDuplicadoHasta(c[j].arreglo, base[j]);
+            c[j].duplicado = pos < c[j].n ? c[j].arreglo[pos] : -1;
+        }
+    }
+}
+
+/**
+ * Arreglo leído de un archivo binario ".i32" (enteros de 32 bits sin encabezado, el mismo
+ * formato de Comun/lecturaEnteros.h). En sistemas POSIX el archivo se mapea con mmap y solo se
+ * leen del disco las páginas que la búsqueda toca; en otros sistemas se lee completo con fread.
+ */
+typedef struct {
+    const int *datos;
+    size_t n;
+    void *memoria;     // Región mapeada o bloque de malloc
+    size_t bytes;
+    int mapeado;       // 1 si memoria viene de mmap
+} ArregloMapeado;
+
+/**
+ * Abre el archivo y deja sus enteros en m->datos. Devuelve 1 si tuvo éxito.
+ * acceso_aleatorio = 1 avisa al sistema que las lecturas serán salteadas (búsqueda binaria),
+ * para que no lea por adelantado páginas que no se usarán.
+ */
+static inline int abrirArregloMapeado(const char *ruta, ArregloMapeado *m, int acceso_aleatorio) {
+    memset(m, 0, sizeof(*m));
+#ifdef DUPLICADOS_MMAP
+    int fd = open(ruta, O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size >= (off_t)sizeof(int)) {
+            void *region = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (region != MAP_FAILED) {
+                close(fd);
+#ifdef MADV_RANDOM
+                // madvise es solo una sugerencia; con -std=c11 sin extensiones no se declara
+                madvise(region, (size_t)info.st_size, acceso_aleatorio ? MADV_RANDOM : MADV_SEQUENTIAL);
+#else
+                (void)acceso_aleatorio;
+#endif
+                m->memoria = region;
+                m->bytes = (size_t)info.st_size;
+                m->datos = (const int *)region;
+                m->n = m->bytes / sizeof(int);
+                m->mapeado = 1;
+                return 1;
+            }
+        }
+        close(fd);
+    }
+#else
+    (void)acceso_aleatorio;
+#endif
+    // Sin mmap: leer todo el archivo
+    FILE *archivo = fopen(ruta, "rb");
+    if (archivo == NULL) {
+        return 0;
+    }
+    size_t capacidad = 1 << 20, n = 0;
+    int *datos = malloc(capacidad * sizeof(int));
+    while (datos != NULL) {
+        n += fread(datos + n, sizeof(int), capacidad - n, archivo);
+        if (n < capacidad) {
+            break;
+        }
+        int *mayor = realloc(datos, 2 * capacidad * sizeof(int));
+        if (mayor == NULL) {
+            free(datos);
+            datos = NULL;
+            break;
+        }
+        datos = mayor;
+        capacidad *= 2;
+    }
+    fclose(archivo);
+    if (datos == NULL) {
+        return 0;
+    }
+    m->memoria = datos;
+    m->bytes = n * sizeof(int);
+    m->datos = datos;
+    m->n = n;
+    return 1;
+}
+
+static inline void cerrarArregloMapeado(ArregloMapeado *m) {
+#ifdef DUPLICADOS_MMAP
+    if (m->mapeado) {
+        munmap(m->memoria, m->bytes);
+        memset(m, 0, sizeof(*m));
+        return;
+    }
+#endif
+    free(m->memoria);
+    memset(m, 0, sizeof(*m));
+}
+
+#endif
@@ -0,0 +1,623 @@
+#ifndef MAYORITARIO_H
+#define MAYORITARIO_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "../Comun/hilos.h"
+
+/**
+ * Elemento mayoritario en tiempo lineal y memoria constante
+ *
+ * comparacionFuerzaB es O(n²) y divideVencerasMayor es O(n log n) porque vuelve a contar
+ * apariciones en cada nivel. El voto de Boyer–Moore encuentra al único candidato posible en una
+ * sola pasada con dos variables; una segunda pasada cuenta sus apariciones para confirmar que
+ * de verdad supera n/2.
+ *
+ * Misra–Gries generaliza el voto a k-1 contadores: cualquier elemento que aparezca más de n/k
+ * veces queda entre los candidatos, y el contador de cada uno subestima su frecuencia real en
+ * a lo más n/k.
+ *
+ * Ambos resúmenes se pueden combinar (el de un bloque con el de otro da un resumen válido del
+ * bloque unido), así que la versión paralela es una reducción: cada hilo resume su parte, se
+ * combinan los resúmenes y una pasada paralela de verificación cuenta los candidatos.
+ *
+ * Compilar con -pthread.
+ */
+
+// Elementos por debajo de los cuales no vale la pena crear hilos
+#define GRANO_MAYORITARIO (1 << 16)
+
+typedef struct {
+    int candidato;
+    long long conteo;   // Votos netos a favor del candidato (0 = sin candidato)
+} VotoMayoritario;
+
+/**
+ * Agrega un elemento al voto de Boyer–Moore: si coincide con el candidato suma, si no resta,
+ * y cuando el conteo llega a 0 el siguiente elemento toma su lugar.
+ */
+static inline void votoAgregar(VotoMayoritario *v, int x) {
+    if (v->conteo == 0) {
+        v->candidato = x;
+        v->conteo = 1;
+    } else if (v->candidato == x) {
+        v->conteo++;
+    } else {
+        v->conteo--;
+    }
+}
+
+/**
+ * Voto de Boyer–Moore sobre arr[0..n-1]
+ * - Complejidad temporal: O(n), una sola pasada
+ * - Complejidad espacial: O(1)
+ */
+static inline VotoMayoritario votarBloque(const int *arr, long long n) {
+    VotoMayoritario v = {0, 0};
+    for (long long i = 0; i < n; i++) {
+        votoAgregar(&v, arr[i]);
+    }
+    return v;
+}
+
+/**
+ * Combina los votos de dos bloques. Con el mismo candidato se suman; con candidatos distintos
+ * se cancelan votos uno a uno y queda el que tenía más. Si el bloque unido tiene mayoritario,
+ * es el candidato resultante.
+ */
+static inline VotoMayoritario votoCombinar(VotoMayoritario a, VotoMayoritario b) {
+    if (a.conteo == 0) return b;
+    if (b.conteo == 0) return a;
+    if (a.candidato == b.candidato) {
+        a.conteo += b.conteo;
+        return a;
+    }
+    if (a.conteo >= b.conteo) {
+        a.conteo -= b.conteo;
+        return a;
+    }
+    b.conteo -= a.conteo;
+    return b;
+}
+
+static inline long long contarValor(const int *arr, long long n, int x) {
+    long long conteo = 0;
+    for (long long i = 0; i < n; i++) {
+        conteo += (arr[i] == x);
+    }
+    return conteo;
+}
+
+/**
+ * Boyer–Moore secuencial con verificación
+ * Devuelve 1 y deja el elemento en *mayoritario si aparece más de n/2 veces; 0 si no hay.
+ */
+static inline int mayoritarioBoyerMoore(const int *arr, long long n, int *mayoritario) {
+    VotoMayoritario v = votarBloque(arr, n);
+    if (v.conteo > 0 && contarValor(arr, n, v.candidato) > n / 2) {
+        *mayoritario = v.candidato;
+        return 1;
+    }
+    return 0;
+}
+
+typedef struct {
+    const int *arr;
+    long long n;
+    VotoMayoritario voto;   // Fase 1
+    int candidato;          // Fase 2: valor a contar
+    long long conteo;       // Fase 2: apariciones en el bloque
+} TareaMayoritario;
+
+static void *hiloVotar(void *arg) {
+    TareaMayoritario *t = (TareaMayoritario *)arg;
+    t->voto = votarBloque(t->arr, t->n);
+    return NULL;
+}
+
+static void *hiloContar(void *arg) {
+    TareaMayoritario *t = (TareaMayoritario *)arg;
+    t->conteo = contarValor(t->arr, t->n, t->candidato);
+    return NULL;
+}
+
+/**
+ * Ejecuta funcion sobre cada tarea: las tareas 1..hilos-1 en hilos nuevos y la 0 en el hilo
+ * actual. Si no se puede crear un hilo, esa tarea se hace también en el hilo actual.
+ */
+static inline void ejecutarTareas(void *(*funcion)(void *), void *tareas, size_t tamTarea, int hilos) {
+    pthread_t ids[hilos > 1 ? hilos : 1];
+    int creado[hilos > 1 ? hilos : 1];
+    for (int h = 1; h < hilos; h++) {
+        void *tarea = (char *)tareas + (size_t)h * tamTarea;
+        creado[h] = pthread_create(&ids[h], NULL, funcion, tarea) == 0;
+        if (!creado[h]) {
+            funcion(tarea);
+        }
+    }
+    funcion(tareas);
+    for (int h = 1; h < hilos; h++) {
+        if (creado[h]) {
+            pthread_join(ids[h], NULL);
+        }
+    }
+}
+
+/**
+ * Boyer–Moore paralelo como reducción
+ * 1. Cada hilo vota sobre su bloque contiguo.
+ * 2. Los votos se combinan con votoCombinar.
+ * 3. Cada hilo cuenta el candidato en su bloque y se suman los conteos.
+ * Devuelve 1 y deja el resultado en *mayoritario si supera n/2; 0 si no hay mayoritario.
+ */
+static inline int mayoritarioParalelo(const int *arr, long long n, int hilos, int *mayoritario) {
+    if (hilos > n / GRANO_MAYORITARIO) {
+        hilos = (int)(n / GRANO_MAYORITARIO);
+    }
+    if (hilos <= 1) {
+        return mayoritarioBoyerMoore(arr, n, mayoritario);
+    }
+    TareaMayoritario tareas[hilos];
+    for (int h = 0; h < hilos; h++) {
+        long long ini = n * h / hilos, fin = n * (h + 1) / hilos;
+        tareas[h].arr = arr + ini;
+        tareas[h].n = fin - ini;
+    }
+    ejecutarTareas(hiloVotar, tareas, sizeof(TareaMayoritario), hilos);
+    VotoMayoritario v = {0, 0};
+    for (int h = 0; h < hilos; h++) {
+        v = votoCombinar(v, tareas[h].voto);
+    }
+    if (v.conteo == 0) {
+        return 0;
+    }
+
+    for (int h = 0; h < hilos; h++) {
+        tareas[h].candidato = v.candidato;
+    }
+    ejecutarTareas(hiloContar, tareas, sizeof(TareaMayoritario), hilos);
+    long long total = 0;
+    for (int h = 0; h < hilos; h++) {
+        total += tareas[h].conteo;
+    }
+    if (total > n / 2) {
+        *mayoritario = v.candidato;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Resumen de Misra–Gries con k-1 contadores
+ * Los candidatos se guardan en arreglos paralelos (valores, conteos) y una tabla hash de
+ * direccionamiento abierto lleva de un valor a su posición. Cuando llega un valor nuevo y no hay
+ * contador libre se resta 1 a todos y se reconstruye la tabla sin los que quedaron en 0; eso pasa
+ * a lo más n/k veces, así que el costo amortizado por elemento es O(1).
+ */
+typedef struct {
+    int k;                  // Se detectan los elementos con más de n/k apariciones
+    int capacidad;          // k - 1 contadores
+    int usados;
+    int *valores;
+    long long *conteos;
+    int *tabla;             // Posición + 1 en valores, o 0 si la celda está libre
+    int tamTabla;           // Potencia de 2, al menos el doble de capacidad
+    long long procesados;   // Elementos vistos (n)
+    long long descuentos;   // Total restado a cada contador: cota del error de cada conteo
+} ResumenMisraGries;
+
+static inline unsigned int hashEntero(int x) {
+    unsigned int h = (unsigned int)x * 2654435761u;
+    return h ^ (h >> 16);
+}
+
+static inline int mgIniciar(ResumenMisraGries *r, int k) {
+    memset(r, 0, sizeof(*r));
+    r->k = k < 2 ? 2 : k;
+    r->capacidad = r->k - 1;
+    r->tamTabla = 4;
+    while (r->tamTabla < 2 * r->capacidad) {
+        r->tamTabla *= 2;
+    }
+    r->valores = malloc((size_t)r->capacidad * sizeof(int));
+    r->conteos = malloc((size_t)r->capacidad * sizeof(long long));
+    r->tabla = calloc((size_t)r->tamTabla, sizeof(int));
+    return r->valores != NULL && r->conteos != NULL && r->tabla != NULL;
+}
+
+static inline void mgLiberar(ResumenMisraGries *r) {
+    free(r->valores);
+    free(r->conteos);
+    free(r->tabla);
+    memset(r, 0, sizeof(*r));
+}
+
+// Celda de la tabla donde está x, o la celda libre donde debería ir
+static inline int mgCelda(const ResumenMisraGries *r, int x) {
+    int mascara = r->tamTabla - 1;
+    int c = (int)(hashEntero(x) & (unsigned int)mascara);
+    while (r->tabla[c] != 0 && r->valores[r->tabla[c] - 1] != x) {
+        c = (c + 1) & mascara;
+    }
+    return c;
+}
+
+// Compacta los contadores en 0 y vuelve a llenar la tabla
+static inline void mgReconstruir(ResumenMisraGries *r) {
+    int j = 0;
+    for (int i = 0; i < r->usados; i++) {
+        if (r->conteos[i] > 0) {
+            r->valores[j] = r->valores[i];
+            r->conteos[j] = r->conteos[i];
+            j++;
+        }
+    }
+    r->usados = j;
+    memset(r->tabla, 0, (size_t)r->tamTabla * sizeof(int));
+    for (int i = 0; i < r->usados; i++) {
+        r->tabla[mgCelda(r, r->valores[i])] = i + 1;
+    }
+}
+
+/**
+ * Agrega cuantas apariciones de x al resumen (cuantas = 1 para un elemento del flujo)
+ */
+static inline void mgAgregar(ResumenMisraGries *r, int x, long long cuantas) {
+    r->procesados += cuantas;
+    while (cuantas > 0) {
+        int c = mgCelda(r, x);
+        if (r->tabla[c] != 0) {
+            r->conteos[r->tabla[c] - 1] += cuantas;
+            return;
+        }
+        if (r->usados < r->capacidad) {
+            r->valores[r->usados] = x;
+            r->conteos[r->usados] = cuantas;
+            r->tabla[c] = ++r->usados;
+            return;
+        }
+        // Sin contador libre: restar a todos (y a x) el menor conteo posible
+        long long resta = cuantas;
+        for (int i = 0; i < r->usados; i++) {
+            if (r->conteos[i] < resta) {
+                resta = r->conteos[i];
+            }
+        }
+        for (int i = 0; i < r->usados; i++) {
+            r->conteos[i] -= resta;
+        }
+        cuantas -= resta;
+        r->descuentos += resta;
+        mgReconstruir(r);
+    }
+}
+
+static inline int compararConteosDesc(const void *a, const void *b) {
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return (x < y) - (x > y);
+}
+
+/**
+ * Combina el resumen b dentro de a (mismo k): suma los contadores de los valores comunes,
+ * agrega los demás y, si quedan más de k-1, resta a todos el k-ésimo conteo más grande y
+ * descarta los que no quedan positivos. El resultado conserva la garantía de error n/k
+ * para el total de elementos de ambos resúmenes. Devuelve 0 si faltó memoria.
+ */
+static inline int mgCombinar(ResumenMisraGries *a, const ResumenMisraGries *b) {
+    int total = a->usados + b->usados;
+    int *valores = malloc((size_t)(total > 0 ? total : 1) * sizeof(int));
+    long long *conteos = malloc((size_t)(total > 0 ? total : 1) * sizeof(long long));
+    long long *ordenados = malloc((size_t)(total > 0 ? total : 1) * sizeof(long long));
+    if (valores == NULL || conteos == NULL || ordenados == NULL) {
+        free(valores);
+        free(conteos);
+        free(ordenados);
+        return 0;
+    }
+    int m = 0;
+    for (int i = 0; i < a->usados; i++) {
+        valores[m] = a->valores[i];
+        conteos[m++] = a->conteos[i];
+    }
+    for (int i = 0; i < b->usados; i++) {
+        int c = mgCelda(a, b->valores[i]);
+        if (a->tabla[c] != 0) {
+            conteos[a->tabla[c] - 1] += b->conteos[i];
+        } else {
+            valores[m] = b->valores[i];
+            conteos[m++] = b->conteos[i];
+        }
+    }
+
+    long long resta = 0;
+    if (m > a->capacidad) {
+        memcpy(ordenados, conteos, (size_t)m * sizeof(long long));
+        qsort(ordenados, (size_t)m, sizeof(long long), compararConteosDesc);
+        resta = ordenados[a->capacidad];   // k-ésimo más grande
+    }
+    a->usados = 0;
+    for (int i = 0; i < m && a->usados < a->capacidad; i++) {
+        if (conteos[i] - resta > 0) {
+            a->valores[a->usados] = valores[i];
+            a->conteos[a->usados++] = conteos[i] - resta;
+        }
+    }
+    a->procesados += b->procesados;
+    a->descuentos += b->descuentos + resta;
+    mgReconstruir(a);
+    free(valores);
+    free(conteos);
+    free(ordenados);
+    return 1;
+}
+
+/**
+ * Conteo exacto de los candidatos del resumen sobre arr[0..n-1] (pasada de verificación).
+ * exactos[i] corresponde a r->valores[i].
+ */
+static inline void mgContarCandidatos(const ResumenMisraGries *r, const int *arr, long long n, long long *exactos) {
+    memset(exactos, 0, (size_t)(r->usados > 0 ? r->usados : 1) * sizeof(long long));
+    for (long long i = 0; i < n; i++) {
+        int c = mgCelda(r, arr[i]);
+        if (r->tabla[c] != 0) {
+            exactos[r->tabla[c] - 1]++;
+        }
+    }
+}
+
+typedef struct {
+    const int *arr;
+    long long n;
+    ResumenMisraGries resumen;   // Fase 1
+    const ResumenMisraGries *candidatos;   // Fase 2
+    long long *exactos;          // Fase 2
+} TareaMisraGries;
+
+static void *hiloResumir(void *arg) {
+    TareaMisraGries *t = (TareaMisraGries *)arg;
+    for (long long i = 0; i < t->n; i++) {
+        mgAgregar(&t->resumen, t->arr[i], 1);
+    }
+    return NULL;
+}
+
+static void *hiloVerificar(void *arg) {
+    TareaMisraGries *t = (TareaMisraGries *)arg;
+    mgContarCandidatos(t->candidatos, t->arr, t->n, t->exactos);
+    return NULL;
+}
+
+/**
+ * Elementos que aparecen más de n/k veces (heavy hitters), en paralelo
+ * Cada hilo arma el resumen de Misra–Gries de su bloque, los resúmenes se combinan en *r y una
+ * pasada paralela cuenta exactamente a los candidatos. Al terminar, r->valores[0..r->usados-1]
+ * son los candidatos y frecuentes[i] vale 1 si r->valores[i] supera n/k (exactos[i] trae su
+ * frecuencia real). r debe estar iniciado con mgIniciar y vacío. Devuelve 0 si faltó memoria.
+ */
+static inline int frecuentesParalelo(const int *arr, long long n, int hilos, ResumenMisraGries *r,
+                                     long long *exactos, int *frecuentes) {
+    if (hilos > n / GRANO_MAYORITARIO) {
+        hilos = (int)(n / GRANO_MAYORITARIO);
+    }
+    if (hilos < 1) {
+        hilos = 1;
+    }
+    TareaMisraGries tareas[hilos];
+    int ok = 1;
+    for (int h = 0; h < hilos; h++) {
+        long long ini = n * h / hilos, fin = n * (h + 1) / hilos;
+        tareas[h].arr = arr + ini;
+        tareas[h].n = fin - ini;
+        tareas[h].exactos = NULL;
+        ok &= mgIniciar(&tareas[h].resumen, r->k);
+    }
+    if (ok) {
+        ejecutarTareas(hiloResumir, tareas, sizeof(TareaMisraGries), hilos);
+        for (int h = 0; h < hilos && ok; h++) {
+            ok = mgCombinar(r, &tareas[h].resumen);
+        }
+    }
+    for (int h = 0; h < hilos && ok; h++) {
+        tareas[h].candidatos = r;
+        tareas[h].exactos = malloc((size_t)r->capacidad * sizeof(long long));
+        ok = tareas[h].exactos != NULL;
+    }
+    if (ok) {
+        ejecutarTareas(hiloVerificar, tareas, sizeof(TareaMisraGries), hilos);
+        for (int i = 0; i < r->usados; i++) {
+            exactos[i] = 0;
+            for (int h = 0; h < hilos; h++) {
+                exactos[i] += tareas[h].exactos[i];
+            }
+            frecuentes[i] = exactos[i] > n / r->k;
+        }
+    }
+    for (int h = 0; h < hilos; h++) {
+        free(tareas[h].exactos);
+        mgLiberar(&tareas[h].resumen);
+    }
+    return ok;
+}
+
+/**
+ * Resumen Space-Saving con m contadores, para flujos de longitud desconocida
+ * A diferencia de Misra–Gries nunca descarta contadores: un valor nuevo sin contador libre
+ * reemplaza al de menor conteo, hereda ese conteo (+1) y lo anota como su error. Así cada conteo
+ * sobreestima la frecuencia real en a lo más su error, y el error nunca pasa de n/m; todo valor
+ * con más de n/m apariciones está en el resumen. Sirve para reportar los más frecuentes con
+ * cotas [conteo - error, conteo] en cualquier momento del flujo.
+ *
+ * Los contadores forman un montículo de mínimos por conteo (la raíz es la que se reemplaza) y
+ * una tabla hash de direccionamiento abierto lleva de cada valor a su posición en el montículo.
+ * La memoria es fija: O(m) sin importar cuántos elementos pasen.
+ */
+typedef struct {
+    int capacidad;          // m contadores
+    int usados;
+    int *valores;           // Montículo de mínimos por conteos
+    long long *conteos;
+    long long *errores;
+    int *celdas;            // Celda de la tabla de cada posición del montículo
+    int *tabla;             // Posición + 1 en el montículo, o 0 si la celda está libre
+    int tamTabla;           // Potencia de 2, al menos el doble de capacidad
+    long long procesados;
+} ResumenSpaceSaving;
+
+static inline int ssIniciar(ResumenSpaceSaving *r, int contadores) {
+    memset(r, 0, sizeof(*r));
+    r->capacidad = contadores < 1 ? 1 : contadores;
+    r->tamTabla = 4;
+    while (r->tamTabla < 2 * r->capacidad) {
+        r->tamTabla *= 2;
+    }
+    r->valores = malloc((size_t)r->capacidad * sizeof(int));
+    r->conteos = malloc((size_t)r->capacidad * sizeof(long long));
+    r->errores = malloc((size_t)r->capacidad * sizeof(long long));
+    r->celdas = malloc((size_t)r->capacidad * sizeof(int));
+    r->tabla = calloc((size_t)r->tamTabla, sizeof(int));
+    return r->valores != NULL && r->conteos != NULL && r->errores != NULL && r->celdas != NULL &&
+           r->tabla != NULL;
+}
+
+static inline void ssLiberar(ResumenSpaceSaving *r) {
+    free(r->valores);
+    free(r->conteos);
+    free(r->errores);
+    free(r->celdas);
+    free(r->tabla);
+    memset(r, 0, sizeof(*r));
+}
+
+// Celda de la tabla donde está x, o la celda libre donde debería ir
+static inline int ssCelda(const ResumenSpaceSaving *r, int x) {
+    int mascara = r->tamTabla - 1;
+    int c = (int)(hashEntero(x) & (unsigned int)mascara);
+    while (r->tabla[c] != 0 && r->valores[r->tabla[c] - 1] != x) {
+        c = (c + 1) & mascara;
+    }
+    return c;
+}
+
+/**
+ * Libera la celda c con borrado por corrimiento: las entradas siguientes del mismo racimo que
+ * quedarían inalcanzables se recorren hacia atrás (y se actualiza su celda en el montículo)
+ */
+static inline void ssBorrarCelda(ResumenSpaceSaving *r, int c) {
+    int mascara = r->tamTabla - 1;
+    int j = c;
+    for (;;) {
+        j = (j + 1) & mascara;
+        if (r->tabla[j] == 0) {
+            break;
+        }
+        int pos = r->tabla[j] - 1;
+        int ideal = (int)(hashEntero(r->valores[pos]) & (unsigned int)mascara);
+        // La entrada se queda si su celda ideal está en el tramo cíclico (c, j]
+        int seQueda = c < j ? (ideal > c && ideal <= j) : (ideal > c || ideal <= j);
+        if (!seQueda) {
+            r->tabla[c] = r->tabla[j];
+            r->celdas[pos] = c;
+            c = j;
+        }
+    }
+    r->tabla[c] = 0;
+}
+
+static inline void ssIntercambiar(ResumenSpaceSaving *r, int a, int b) {
+    int v = r->valores[a], celda = r->celdas[a];
+    long long conteo = r->conteos[a], error = r->errores[a];
+    r->valores[a] = r->valores[b];
+    r->conteos[a] = r->conteos[b];
+    r->errores[a] = r->errores[b];
+    r->celdas[a] = r->celdas[b];
+    r->valores[b] = v;
+    r->conteos[b] = conteo;
+    r->errores[b] = error;
+    r->celdas[b] = celda;
+    r->tabla[r->celdas[a]] = a + 1;
+    r->tabla[r->celdas[b]] = b + 1;
+}
+
+// Hunde la posición i mientras tenga un hijo con menor conteo
+static inline void ssHundir(ResumenSpaceSaving *r, int i) {
+    for (;;) {
+        int menor = i, izq = 2 * i + 1, der = izq + 1;
+        if (izq < r->usados && r->conteos[izq] < r->conteos[menor]) menor = izq;
+        if (der < r->usados && r->conteos[der] < r->conteos[menor]) menor = der;
+        if (menor == i) {
+            return;
+        }
+        ssIntercambiar(r, i, menor);
+        i = menor;
+    }
+}
+
+static inline void ssSubir(ResumenSpaceSaving *r, int i) {
+    while (i > 0 && r->conteos[(i - 1) / 2] > r->conteos[i]) {
+        ssIntercambiar(r, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+/**
+ * Agrega una aparición de x. O(1) para un valor ya vigilado cuyo conteo no supera a sus hijos,
+ * O(log m) en el peor caso.
+ */
+static inline void ssAgregar(ResumenSpaceSaving *r, int x) {
+    r->procesados++;
+    int c = ssCelda(r, x);
+    if (r->tabla[c] != 0) {
+        int pos = r->tabla[c] - 1;
+        r->conteos[pos]++;
+        ssHundir(r, pos);
+        return;
+    }
+    if (r->usados < r->capacidad) {
+        int pos = r->usados++;
+        r->valores[pos] = x;
+        r->conteos[pos] = 1;
+        r->errores[pos] = 0;
+        r->celdas[pos] = c;
+        r->tabla[c] = pos + 1;
+        ssSubir(r, pos);
+        return;
+    }
+    // Reemplazar al de menor conteo (la raíz)
+    ssBorrarCelda(r, r->celdas[0]);
+    r->valores[0] = x;
+    r->errores[0] = r->conteos[0];
+    r->conteos[0]++;
+    c = ssCelda(r, x);
+    r->celdas[0] = c;
+    r->tabla[c] = 1;
+    ssHundir(r, 0);
+}
+
+/**
+ * Deja en orden[0..t-1] las posiciones de los t contadores más grandes, de mayor a menor.
+ * Devuelve t (a lo más r->usados).
+ */
+static inline int ssMasFrecuentes(const ResumenSpaceSaving *r, int *orden, int t) {
+    if (t > r->usados) {
+        t = r->usados;
+    }
+    if (t <= 0) {
+        return 0;
+    }
+    // Selección por inserción sobre un arreglo de t posiciones: t es chico frente a m
+    int llenos = 0;
+    for (int i = 0; i < r->usados; i++) {
+        if (llenos == t && r->conteos[i] <= r->conteos[orden[t - 1]]) {
+            continue;
+        }
+        int j = llenos < t ? llenos++ : t - 1;
+        while (j > 0 && r->conteos[orden[j - 1]] < r->conteos[i]) {
+            orden[j] = orden[j - 1];
+            j--;
+        }
+        orden[j] = i;
+    }
+    return t;
+}
+
+#endif
@@ -1,5 +1,23 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
+#include "duplicados.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
+
+/**
+ * Compilación: gcc numDobles.c -o numDobles
+ * Ejecución:   ./numDobles                          Ejemplos de la práctica
+ *              ./numDobles --benchmark [--desde e] [--hasta e] [--consultas q] [--rondas r] [--cerca]
+ *                  Consultas por segundo de cada estrategia con n = 10^desde ... 10^hasta
+ *                  (por defecto 10^3 a 10^8; 10^9 necesita unos 4 GB de memoria).
+ *                  Con --cerca el duplicado queda dentro de las primeras 64 posiciones.
+ *              ./numDobles --generar-archivo {n} {archivo.i32} [--semilla s]
+ *                  Escribe 1..n-1 con un duplicado al azar en binario, por bloques
+ *              ./numDobles --archivo {archivo.i32}
+ *                  Busca el duplicado en el archivo mapeado en memoria con cada estrategia
+ */
 
 /**
  * Recorre el arreglo secuencialmente comparando cada elemento con el siguiente.
@@ -87,7 +105,242 @@ void imprimirArreglo(int arr[], int n) {
     printf("]\n");
 }
 
-int main() {
+// Resultado y comparaciones de las estrategias de duplicados.h para un arreglo de ejemplo
+void imprimirBusquedasBiblioteca(int arr[], int n) {
+    for (int e = BUSQUEDA_SECUENCIAL; e <= BUSQUEDA_GALOPE; e++) {
+        ConsultaDuplicado consulta = {arr, (size_t)n, 0, 0};
+        resolverConsulta(&consulta, (EstrategiaDuplicado)e);
+        printf("  %-10s %d (%lld comparaciones)\n", NOMBRES_ESTRATEGIA_DUPLICADO[e], consulta.duplicado,
+               consulta.comparaciones);
+    }
+    printf("\n");
+}
+
+/**
+ * Llena arr[0..total-1] con 1, 2, 3, ... repitiendo un valor en las posiciones
+ * d, d + (n-1), d + 2(n-1), ... (arr[p] == arr[p-1]).
+ * Así cualquier ventana de n elementos es un arreglo válido del problema: n-1 valores
+ * consecutivos con exactamente un duplicado.
+ */
+void llenarConDuplicados(int *arr, size_t total, size_t n, size_t d) {
+    int valor = 1;
+    size_t siguiente = d;
+    arr[0] = valor;
+    for (size_t i = 1; i < total; i++) {
+        if (i == siguiente) {
+            siguiente += n - 1;
+        } else {
+            valor++;
+        }
+        arr[i] = valor;
+    }
+}
+
+/**
+ * Benchmark de rendimiento: para cada n, cada consulta es una ventana distinta de n elementos
+ * dentro de un mismo bloque de memoria, con el duplicado en una posición al azar. Se reportan
+ * consultas por segundo, nanosegundos y comparaciones promedio por consulta. Las respuestas de
+ * todas las estrategias se comparan con la esperada.
+ */
+int benchmarkDuplicados(int desde, int hasta, size_t consultasPorRonda, int rondas, int cerca) {
+    printf("%12s %-11s %10s %14s %14s %16s\n", "n", "estrategia", "consultas", "ns/consulta", "consultas/s",
+           "comparaciones");
+    GeneradorAleatorio g;
+    generadorSembrar(&g, 2025);
+    size_t n = 1;
+    for (int e = 0; e < desde; e++) {
+        n *= 10;
+    }
+    for (int e = desde; e <= hasta; e++, n *= 10) {
+        size_t ventana = n < (1u << 16) ? n : (1u << 16);
+        size_t total = n + ventana;
+        int *bloque = malloc(total * sizeof(int));
+        ConsultaDuplicado *consultas = malloc(consultasPorRonda * sizeof(ConsultaDuplicado));
+        int *esperados = malloc(consultasPorRonda * sizeof(int));
+        if (bloque == NULL || consultas == NULL || esperados == NULL) {
+            printf("Error: No se pudo asignar memoria para n = %zu\n", n);
+            free(bloque);
+            free(consultas);
+            free(esperados);
+            return 0;
+        }
+
+        // Nombre de las filas: las tres estrategias más la binaria en lote
+        const char *nombres[] = {"secuencial", "binaria", "galope", "lote"};
+        double tiempo[4] = {0};
+        long long comparaciones[4] = {0}, resueltas[4] = {0};
+        long long errores = 0;
+
+        for (int r = 0; r < rondas; r++) {
+            // Posición del duplicado en el bloque y posición de inicio de cada ventana
+            size_t d = cerca ? 64 + generadorRango(&g, (uint32_t)(ventana > 64 ? ventana - 64 : 1))
+                             : 1 + generadorRango(&g, (uint32_t)(n - 1));
+            llenarConDuplicados(bloque, total, n, d);
+            for (size_t q = 0; q < consultasPorRonda; q++) {
+                size_t inicio = cerca ? d - 1 - generadorRango(&g, 64) : generadorRango(&g, (uint32_t)ventana);
+                if (inicio + n > total) {
+                    inicio = total - n;
+                }
+                consultas[q].arreglo = bloque + inicio;
+                consultas[q].n = n;
+                // La repetición dentro de la ventana es la primera posición de la serie mayor que inicio
+                size_t p = d;
+                if (inicio >= d) {
+                    p = d + ((inicio - d) / (n - 1) + 1) * (n - 1);
+                }
+                esperados[q] = bloque[p];
+            }
+
+            for (int s = 0; s < 4; s++) {
+                // La secuencial recorre O(n) por consulta: se limita para que cada ronda tarde lo mismo
+                size_t cuantas = consultasPorRonda;
+                if (s == 0 && !cerca) {
+                    size_t limite = 200000000 / n;
+                    cuantas = limite < 1 ? 1 : (limite < cuantas ? limite : cuantas);
+                }
+                double t = tiempoMonotonico();
+                if (s == 3) {
+                    resolverConsultas(consultas, cuantas, BUSQUEDA_BINARIA);
+                } else {
+                    for (size_t q = 0; q < cuantas; q++) {
+                        resolverConsulta(&consultas[q], (EstrategiaDuplicado)s);
+                    }
+                }
+                tiempo[s] += tiempoMonotonico() - t;
+                for (size_t q = 0; q < cuantas; q++) {
+                    comparaciones[s] += consultas[q].comparaciones;
+                    errores += consultas[q].duplicado != esperados[q];
+                }
+                resueltas[s] += (long long)cuantas;
+            }
+        }
+
+        for (int s = 0; s < 4; s++) {
+            printf("%12zu %-11s %10lld %14.1f %14.0f %16.1f\n", n, nombres[s], resueltas[s],
+                   1e9 * tiempo[s] / resueltas[s], resueltas[s] / tiempo[s],
+                   (double)comparaciones[s] / resueltas[s]);
+        }
+        if (errores > 0) {
+            printf("Error: %lld respuestas distintas de la esperada con n = %zu\n", errores, n);
+        }
+        fflush(stdout);
+        free(bloque);
+        free(consultas);
+        free(esperados);
+        if (errores > 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Escribe en un archivo ".i32" los valores 1..n-1 con un duplicado en una posición al azar,
+ * por bloques de 1 MiB para no necesitar el arreglo completo en memoria.
+ */
+int generarArchivoDuplicados(long long n, const char *ruta, unsigned long long semilla) {
+    FILE *archivo = fopen(ruta, "wb");
+    int *bloque = malloc((1 << 18) * sizeof(int));
+    if (archivo == NULL || bloque == NULL || n < 2) {
+        if (archivo != NULL) fclose(archivo);
+        free(bloque);
+        return 0;
+    }
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    long long d = 1 + (long long)((generadorSiguiente(&g) >> 11) % (unsigned long long)(n - 1));
+    int ok = 1;
+    for (long long i = 0; i < n && ok; ) {
+        long long cuantos = n - i < (1 << 18) ? n - i : (1 << 18);
+        for (long long k = 0; k < cuantos; k++, i++) {
+            bloque[k] = (int)(i < d ? i + 1 : i);
+        }
+        ok = fwrite(bloque, sizeof(int), (size_t)cuantos, archivo) == (size_t)cuantos;
+    }
+    free(bloque);
+    ok &= fclose(archivo) == 0;
+    if (ok) {
+        printf("Archivo %s: %lld enteros, duplicado %lld en las posiciones %lld y %lld\n", ruta, n, d, d - 1, d);
+    }
+    return ok;
+}
+
+/**
+ * Busca el duplicado en un archivo ".i32" mapeado en memoria con las tres estrategias
+ */
+int buscarEnArchivo(const char *ruta) {
+    for (int e = BUSQUEDA_BINARIA; e <= BUSQUEDA_GALOPE + 1; e++) {
+        // La secuencial va al final: lee todo el archivo y deja sus páginas en memoria
+        EstrategiaDuplicado estrategia = (EstrategiaDuplicado)(e % (BUSQUEDA_GALOPE + 1));
+        ArregloMapeado m;
+        double t = tiempoMonotonico();
+        if (!abrirArregloMapeado(ruta, &m, estrategia != BUSQUEDA_SECUENCIAL)) {
+            printf("Error: No se pudo abrir %s\n", ruta);
+            return 0;
+        }
+        double tAbrir = tiempoMonotonico() - t;
+        ConsultaDuplicado consulta = {m.datos, m.n, 0, 0};
+        t = tiempoMonotonico();
+        resolverConsulta(&consulta, estrategia);
+        t = tiempoMonotonico() - t;
+        printf("%-10s duplicado %d, %lld comparaciones, %f s (abrir%s: %f s)\n",
+               NOMBRES_ESTRATEGIA_DUPLICADO[estrategia], consulta.duplicado, consulta.comparaciones, t,
+               m.mapeado ? " con mmap" : " y leer", tAbrir);
+        cerrarArregloMapeado(&m);
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        int desde = 3, hasta = 8, rondas = 4, cerca = 0;
+        long long consultas = 100000;
+        unsigned long long semilla = 1;
+        const char *rutaGenerar = NULL, *rutaArchivo = NULL;
+        long long nGenerar = 0;
+        int benchmark = 0;
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = 1;
+            } else if (strcmp(argv[i], "--desde") == 0 && i + 1 < argc) {
+                desde = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--hasta") == 0 && i + 1 < argc) {
+                hasta = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--consultas") == 0 && i + 1 < argc) {
+                consultas = atoll(argv[++i]);
+            } else if (strcmp(argv[i], "--rondas") == 0 && i + 1 < argc) {
+                rondas = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--cerca") == 0) {
+                cerca = 1;
+            } else if (strcmp(argv[i], "--semilla") == 0 && i + 1 < argc) {
+                semilla = strtoull(argv[++i], NULL, 10);
+            } else if (strcmp(argv[i], "--generar-archivo") == 0 && i + 2 < argc) {
+                nGenerar = atoll(argv[++i]);
+                rutaGenerar = argv[++i];
+            } else if (strcmp(argv[i], "--archivo") == 0 && i + 1 < argc) {
+                rutaArchivo = argv[++i];
+            } else {
+                printf("Opcion no reconocida: %s\n", argv[i]);
+                return 1;
+            }
+        }
+        if (desde < 2) desde = 2;
+        if (hasta > 9) hasta = 9;
+        if (consultas < 1) consultas = 1;
+        if (rondas < 1) rondas = 1;
+        if (rutaGenerar != NULL && !generarArchivoDuplicados(nGenerar, rutaGenerar, semilla)) {
+            printf("Error: No se pudo escribir %s\n", rutaGenerar);
+            return 1;
+        }
+        if (rutaArchivo != NULL && !buscarEnArchivo(rutaArchivo)) {
+            return 1;
+        }
+        if (benchmark && !benchmarkDuplicados(desde, hasta, (size_t)consultas, rondas, cerca)) {
+            return 1;
+        }
+        return 0;
+    }
+
     // Ejemplo 1
     int arr1[] = {1, 2, 3, 4, 5, 6, 7, 8, 8, 9, 10, 11, 12, 13, 14, 15, 16};
     int n1 = (sizeof(arr1)/sizeof(arr1[0]));
@@ -104,19 +357,22 @@ int main() {
     printf("Arreglo 1: ");
     imprimirArreglo(arr1, n1);
     printf("Fuerza bruta: %d\n", busquedaSecuencial(arr1, n1));
-    printf("Divide y vencerás: %d\n\n", busquedaBinariaMod(arr1, 0, n1-1));
+    printf("Divide y vencerás: %d\n", busquedaBinariaMod(arr1, 0, n1-1));
+    imprimirBusquedasBiblioteca(arr1, n1);
     
     // Prueba 2
     printf("Arreglo 2: ");
     imprimirArreglo(arr2, n2);
     printf("Fuerza bruta: %d\n", busquedaSecuencial(arr2, n2));
-    printf("Divide y vencerás: %d\n\n", busquedaBinariaMod(arr2, 0, n2-1));
+    printf("Divide y vencerás: %d\n", busquedaBinariaMod(arr2, 0, n2-1));
+    imprimirBusquedasBiblioteca(arr2, n2);
     
     // Prueba 3
     printf("Arreglo 3: ");
     imprimirArreglo(arr3, n3);
     printf("Fuerza bruta: %d\n", busquedaSecuencial(arr3, n3));
-    printf("Divide y vencerás: %d\n\n", busquedaBinariaMod(arr3, 0, n3-1));
+    printf("Divide y vencerás: %d\n", busquedaBinariaMod(arr3, 0, n3-1));
+    imprimirBusquedasBiblioteca(arr3, n3);
     
     return 0;
 }
\ No newline at end of file
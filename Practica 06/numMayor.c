@@ -1,5 +1,25 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mayoritario.h"
+#include "../Comun/lecturaEnteros.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
+
+/**
+ * Compilación: gcc numMayor.c -o numMayor -pthread
+ * Ejecución:   ./numMayor                           Ejemplos de la práctica
+ *              ./numMayor --benchmark {n} [--hilos h] [--k k] [--semilla s]
+ *                  Mide Boyer–Moore (secuencial y paralelo) y Misra–Gries sobre n elementos al azar
+ *                  con un mayoritario plantado, y lista los elementos con más de n/k apariciones
+ *                  de un flujo con pocos valores frecuentes (por defecto k = 10)
+ *              ./numMayor --flujo [--entrada archivo] [--contadores m] [--cada c] [--top t]
+ *                  Lee enteros de la entrada estándar (o de un archivo de texto o .i32) sin guardarlos
+ *                  y cada c elementos (por defecto 10^7) imprime los t más frecuentes (por defecto 10)
+ *                  con cotas de su frecuencia real. Usa memoria fija: m contadores (por defecto 1000)
+ *                  y un bloque de lectura, sin importar cuánto dure el flujo.
+ */
 
 /** 
  * Para cada elemento del arreglo, contamos cuántas veces aparece
@@ -131,8 +151,231 @@ void imprimirArreglo(int arr[], int n) {
     printf("]\n");
 }
 
-int main() {
-    
+// Imprime un arreglo, sus mayoritarios por cada método y los que aparecen más de n/3 veces
+void imprimirCaso(const char *nombre, int arr[], int n) {
+    printf("%s: ", nombre);
+    imprimirArreglo(arr, n);
+    printf("Fuerza bruta: %d\n", comparacionFuerzaB(arr, n));
+    printf("Divide y vencerás: %d\n", divideVencerasMayor(arr, 0, n - 1));
+    int mayoritario;
+    if (mayoritarioBoyerMoore(arr, n, &mayoritario)) {
+        printf("Boyer-Moore: %d\n", mayoritario);
+    } else {
+        printf("Boyer-Moore: sin mayoritario\n");
+    }
+
+    ResumenMisraGries r;
+    long long exactos[2];
+    int frecuentes[2];
+    if (mgIniciar(&r, 3) && frecuentesParalelo(arr, n, 1, &r, exactos, frecuentes)) {
+        printf("Mas de n/3 apariciones:");
+        for (int i = 0; i < r.usados; i++) {
+            if (frecuentes[i]) {
+                printf(" %d (%lld veces)", r.valores[i], exactos[i]);
+            }
+        }
+        printf("\n");
+    }
+    mgLiberar(&r);
+    printf("\n");
+}
+
+/**
+ * Llena arr con n valores al azar en [0, n) y coloca un mayoritario (el valor -7) en
+ * n/2 + 1 posiciones al azar
+ */
+void llenarConMayoritario(int arr[], long long n, GeneradorAleatorio *g) {
+    for (long long i = 0; i < n; i++) {
+        arr[i] = (int)generadorRango(g, (uint32_t)n);
+    }
+    // Las primeras n/2 + 1 posiciones de una permutación parcial al azar
+    for (long long i = 0; i <= n / 2; i++) {
+        arr[i] = -7;
+    }
+    for (long long i = n - 1; i > 0; i--) {
+        long long j = (long long)generadorRango(g, (uint32_t)(i + 1));
+        int aux = arr[i];
+        arr[i] = arr[j];
+        arr[j] = aux;
+    }
+}
+
+/**
+ * Flujo tipo bitácora de tráfico: pocos valores concentran la mayor parte de las apariciones
+ * (el valor v, para v < 16, aparece con probabilidad 2^-(v+1)) y el resto son valores únicos al azar
+ */
+void llenarFlujoFrecuentes(int arr[], long long n, GeneradorAleatorio *g) {
+    for (long long i = 0; i < n; i++) {
+        uint64_t r = generadorSiguiente(g);
+        int v = __builtin_ctzll(r | (1ull << 63));
+        arr[i] = v < 16 ? v : 1000 + (int)(r >> 33);
+    }
+}
+
+int benchmarkMayoritario(long long n, int hilos, int k, unsigned long long semilla) {
+    int *arr = malloc((size_t)n * sizeof(int));
+    if (arr == NULL) {
+        printf("Error: No se pudo asignar memoria\n");
+        return 1;
+    }
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    llenarConMayoritario(arr, n, &g);
+
+    int mayoritario = 0, hay;
+    double t = tiempoMonotonico();
+    hay = mayoritarioBoyerMoore(arr, n, &mayoritario);
+    double tSecuencial = tiempoMonotonico() - t;
+    printf("n = %lld, hilos = %d\n", n, hilos);
+    printf("Boyer-Moore secuencial: %s%d en %f s\n", hay ? "" : "sin mayoritario ", mayoritario, tSecuencial);
+
+    t = tiempoMonotonico();
+    hay = mayoritarioParalelo(arr, n, hilos, &mayoritario);
+    double tParalelo = tiempoMonotonico() - t;
+    printf("Boyer-Moore paralelo:   %s%d en %f s (%.2fx)\n", hay ? "" : "sin mayoritario ", mayoritario, tParalelo,
+           tSecuencial / tParalelo);
+    if (n <= 100000) {
+        t = tiempoMonotonico();
+        int dyv = divideVencerasMayor(arr, 0, (int)n - 1);
+        printf("Divide y vencerás:      %d en %f s\n", dyv, tiempoMonotonico() - t);
+    }
+
+    llenarFlujoFrecuentes(arr, n, &g);
+    ResumenMisraGries r;
+    int ok = mgIniciar(&r, k);
+    long long *exactos = malloc((size_t)k * sizeof(long long));
+    int *frecuentes = malloc((size_t)k * sizeof(int));
+    if (ok && exactos != NULL && frecuentes != NULL) {
+        t = tiempoMonotonico();
+        ok = frecuentesParalelo(arr, n, hilos, &r, exactos, frecuentes);
+        t = tiempoMonotonico() - t;
+    } else {
+        ok = 0;
+    }
+    if (ok) {
+        printf("\nMisra-Gries (k = %d, %d contadores) en %f s: mas de %lld apariciones\n", r.k, r.capacidad, t,
+               n / r.k);
+        for (int i = 0; i < r.usados; i++) {
+            if (frecuentes[i]) {
+                printf("  %d: %lld veces (resumen: %lld, error maximo %lld)\n", r.valores[i], exactos[i],
+                       r.conteos[i], r.descuentos);
+            }
+        }
+    } else {
+        printf("Error: No se pudo asignar memoria\n");
+    }
+
+    mgLiberar(&r);
+    free(exactos);
+    free(frecuentes);
+    free(arr);
+    return ok ? 0 : 1;
+}
+
+// Elementos que se leen de la fuente en cada llamada del modo --flujo
+#define BLOQUE_FLUJO 65536
+
+// Imprime los t contadores más grandes del resumen con sus cotas de frecuencia
+void reportarFrecuentes(const ResumenSpaceSaving *r, int *orden, int t) {
+    int m = ssMasFrecuentes(r, orden, t);
+    printf("# procesados %lld (error maximo por conteo: %lld)\n", r->procesados, r->procesados / r->capacidad);
+    for (int i = 0; i < m; i++) {
+        int pos = orden[i];
+        printf("%d\t%lld\t[%lld, %lld]\n", r->valores[pos], r->conteos[pos], r->conteos[pos] - r->errores[pos],
+               r->conteos[pos]);
+    }
+    fflush(stdout);
+}
+
+/**
+ * Modo --flujo: consume la fuente por bloques de BLOQUE_FLUJO enteros y alimenta un resumen
+ * Space-Saving; nunca guarda más de un bloque.
+ */
+int seguirFlujo(const char *ruta, int contadores, long long cada, int top) {
+    FuenteEnteros fuente;
+    if (!fuenteAbrir(&fuente, ruta)) {
+        printf("Error: No se pudo abrir %s\n", ruta != NULL ? ruta : "la entrada estandar");
+        return 1;
+    }
+    ResumenSpaceSaving r;
+    int ok = ssIniciar(&r, contadores);
+    int *bloque = malloc(BLOQUE_FLUJO * sizeof(int));
+    int *orden = malloc((size_t)top * sizeof(int));
+    if (!ok || bloque == NULL || orden == NULL) {
+        printf("Error: No se pudo asignar memoria\n");
+        ssLiberar(&r);
+        free(orden);
+        free(bloque);
+        fuenteCerrar(&fuente);
+        return 1;
+    }
+
+    long long siguienteReporte = cada;
+    long long leidos;
+    while ((leidos = fuenteLeer(&fuente, bloque, BLOQUE_FLUJO)) > 0) {
+        for (long long i = 0; i < leidos; i++) {
+            ssAgregar(&r, bloque[i]);
+            if (r.procesados == siguienteReporte) {
+                reportarFrecuentes(&r, orden, top);
+                siguienteReporte += cada;
+            }
+        }
+    }
+    if (r.procesados != siguienteReporte - cada || r.procesados == 0) {
+        reportarFrecuentes(&r, orden, top);
+    }
+
+    ssLiberar(&r);
+    free(orden);
+    free(bloque);
+    fuenteCerrar(&fuente);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        long long n = -1, cada = 10000000;
+        int hilos = numeroNucleos(), k = 10, flujo = 0, contadores = 1000, top = 10;
+        const char *rutaEntrada = NULL;
+        unsigned long long semilla = (unsigned long long)time(NULL);
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc) {
+                n = atoll(argv[++i]);
+            } else if (strcmp(argv[i], "--hilos") == 0 && i + 1 < argc) {
+                hilos = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--k") == 0 && i + 1 < argc) {
+                k = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--semilla") == 0 && i + 1 < argc) {
+                semilla = strtoull(argv[++i], NULL, 10);
+            } else if (strcmp(argv[i], "--flujo") == 0) {
+                flujo = 1;
+            } else if (strcmp(argv[i], "--entrada") == 0 && i + 1 < argc) {
+                rutaEntrada = argv[++i];
+            } else if (strcmp(argv[i], "--contadores") == 0 && i + 1 < argc) {
+                contadores = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--cada") == 0 && i + 1 < argc) {
+                cada = atoll(argv[++i]);
+            } else if (strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+                top = atoi(argv[++i]);
+            } else {
+                printf("Opcion no reconocida: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        if (flujo) {
+            if (contadores < 1 || cada < 1 || top < 1) {
+                printf("Error: --contadores, --cada y --top deben ser positivos\n");
+                return 1;
+            }
+            return seguirFlujo(rutaEntrada, contadores, cada, top);
+        }
+        if (n <= 0 || n > 2147483647LL || hilos < 1 || k < 2) {
+            printf("Error: se necesita --benchmark n con 0 < n < 2^31, hilos >= 1 y k >= 2\n");
+            return 1;
+        }
+        return benchmarkMayoritario(n, hilos, k, semilla);
+    }
+
     // Caso 1
     int arr1[] = {3, 3, 4, 2, 4, 4, 2, 4, 4};
     int n1 = sizeof(arr1) / sizeof(arr1[0]);
@@ -149,19 +392,10 @@ int main() {
     int arr4[] = {7, 7, 7, 7, 7};
     int n4 = sizeof(arr4) / sizeof(arr4[0]);
     
-    printf("Arreglo 1: ");
-    imprimirArreglo(arr1, n1);
-    int resultado1a = comparacionFuerzaB(arr1, n1);
-    int resultado1b = divideVencerasMayor(arr1, 0, n1 - 1);
-    printf("Fuerza bruta: %d\n", resultado1a);
-    printf("Divide y vencerás: %d\n", resultado1b);
-    
-    printf("Arreglo 2: ");
-    imprimirArreglo(arr1, n1);
-    int resultado1a = comparacionFuerzaB(arr2, n2);
-    int resultado1b = divideVencerasMayor(arr2, 0, n2 - 1);
-    printf("Fuerza bruta: %d\n", resultado1a);
-    printf("Divide y vencerás: %d\n", resultado1b);
+    imprimirCaso("Arreglo 1", arr1, n1);
+    imprimirCaso("Arreglo 2", arr2, n2);
+    imprimirCaso("Arreglo 3", arr3, n3);
+    imprimirCaso("Arreglo 4", arr4, n4);
     
     return 0;
-}
\ No newline at end of file
+}
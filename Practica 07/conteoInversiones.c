@@ -2,85 +2,707 @@
   Autor: Aldo Garcia Ambrosio (C) Marzo 2025
   Merge Sort con conteo de inversiones
   
-  Compilación: gcc ordenMerge.c -o merge
+  Compilación: gcc conteoInversiones.c -o merge -pthread
   Ejecución: ./merge {elementos a ordenar} < lista_caracteres.txt
+             ./merge {elementos a ordenar} --entrada {archivo .txt o .i32}
+             ./merge {elementos a ordenar} --hilos {k} --silencioso < numeros.txt
+
+  Opciones:
+    --entrada {archivo}  Lee los datos de un archivo de texto o binario ".i32"
+    --hilos {k}          Hilos para la versión paralela (por defecto, los núcleos del equipo;
+                         con 1 se usa la versión secuencial)
+    --silencioso         No imprime el arreglo antes y después del ordenamiento
+    --iterativo          Usa el merge sort de abajo hacia arriba (sin recursión, un solo hilo)
+    --externo            Modo de memoria externa para entradas que no caben en RAM: ordena bloques,
+                         los guarda en archivos temporales y los mezcla contando inversiones.
+                         En este modo la cantidad de elementos es opcional (0 o sin indicar = todo
+                         el archivo) y el arreglo no se imprime
+    --memoria {MB}       Presupuesto de memoria del modo externo (por defecto 256 MB)
+    --salida {archivo}   En modo externo, guarda ahí la entrada ordenada (texto o ".i32")
+    --generar {clase}    Genera los datos en memoria en lugar de leerlos (aleatorios, ordenados,
+                         inversos o casiOrdenados; ver Comun/generador.h)
+    --semilla {s}        Semilla del generador (por defecto 1)
+    --desplazados {k}    Posiciones revueltas en casiOrdenados (por defecto 10)
+
+  Ejemplo (datos generados):
+             ./merge 100000000 --generar casiOrdenados --desplazados 1000 --semilla 3 --silencioso
+
+  Ejemplo (modo externo):
+             ./merge --externo --memoria 512 --entrada ranking.i32 --salida ranking_ordenado.i32
 */
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "../Comun/lecturaEnteros.h"
+#include "../Comun/medicion.h"
+#include "../Comun/hilos.h"
+#include "../Comun/generador.h"
 
-// Variable global para contar inversiones (opcional)
-long long int inversiones_totales = 0;
+// Tramos con menos elementos que este se ordenan y mezclan sin crear hilos nuevos
+#define GRANO_PARALELO (1 << 15)
+
+// Tramos con menos elementos que este se ordenan por inserción
+#define UMBRAL_INSERCION 32
 
 /*
 OPCIÓN 2: Merge con conteo de inversiones
 Esta función mezcla Y cuenta cuántas inversiones hay
 Una inversión ocurre cuando un elemento de la mitad derecha
 es menor que elementos de la mitad izquierda
+origen[iniA..finA] y origen[iniB..finB] se mezclan en destino a partir de posDestino.
+No reserva memoria: quien llama decide entre qué arreglos se mezcla, así que no hace
+falta copiar el resultado de regreso. Cada rango se indica por separado para que la
+mezcla paralela pueda partir el problema en pedazos que no son contiguos.
+Regresa las inversiones entre los dos rangos (pares a > b con a en A y b en B)
+*/
+long long mezclarRangosConInversiones(const int *origen, int iniA, int finA, int iniB, int finB,
+                                      int *destino, int posDestino) {
+    long long inversiones = 0;
+    int i = iniA, j = iniB, k = posDestino;
+    while (i <= finA && j <= finB) {
+        if (origen[i] <= origen[j]) {
+            destino[k++] = origen[i++];
+        } else {
+            // Si tomamos un elemento de la derecha, significa que
+            // TODOS los elementos restantes de la izquierda (desde i hasta finA)
+            // son mayores y forman inversiones
+            destino[k++] = origen[j++];
+            inversiones += (finA - i + 1);  // Contar inversiones
+        }
+    }
+    while (i <= finA) {
+        destino[k++] = origen[i++];
+    }
+    while (j <= finB) {
+        destino[k++] = origen[j++];
+    }
+    return inversiones;
+}
+
+/*
+insercionConInversiones - Ordena arregloDes[posIni..posFin] por inserción
+Cada desplazamiento de un elemento hacia la derecha deshace exactamente una inversión,
+así que el número de desplazamientos es el número de inversiones del tramo.
+Se usa para los tramos pequeños, donde es más rápido que seguir dividiendo.
 */
-void MergeConInversiones(int *arregloDes, int posIni, int mitad, int posFin){
-    int l = posFin - posIni + 1, i = posIni, j = mitad + 1, k;
+long long insercionConInversiones(int *arregloDes, int posIni, int posFin) {
+    long long inversiones = 0;
+    for (int k = posIni + 1; k <= posFin; k++) {
+        int valor = arregloDes[k];
+        int i = k - 1;
+        while (i >= posIni && arregloDes[i] > valor) {
+            arregloDes[i + 1] = arregloDes[i];
+            i--;
+        }
+        arregloDes[i + 1] = valor;
+        inversiones += k - 1 - i;
+    }
+    return inversiones;
+}
+
+/*
+ordenarPingPong - Merge sort sin copias de regreso
+Al entrar, origen y destino tienen los mismos valores en [posIni, posFin]; al salir el rango
+queda ordenado en destino. Las mitades se ordenan hacia origen (intercambiando los papeles de
+los arreglos en la llamada recursiva) y después se mezclan de origen a destino, así que en
+cada nivel los datos pasan una sola vez de un arreglo al otro.
+*/
+long long ordenarPingPong(int *origen, int *destino, int posIni, int posFin) {
+    if (posFin - posIni < UMBRAL_INSERCION) {
+        return insercionConInversiones(destino, posIni, posFin);
+    }
+    int mitad = (posIni + posFin) / 2;
+    long long inversiones = 0;
+
+    // Ordenar y contar inversiones en cada mitad, dejando el resultado en origen
+    inversiones += ordenarPingPong(destino, origen, posIni, mitad);
+    inversiones += ordenarPingPong(destino, origen, mitad + 1, posFin);
+
+    // Mezclar y contar inversiones entre mitades
+    inversiones += mezclarRangosConInversiones(origen, posIni, mitad, mitad + 1, posFin, destino, posIni);
+    return inversiones;
+}
+
+/*
+mergeSortConInversiones - Versión que cuenta inversiones
+Reserva un solo arreglo auxiliar para todo el ordenamiento (en lugar de uno por cada mezcla)
+y alterna entre él y el arreglo original con ordenarPingPong.
+Regresa el número de inversiones del rango [posIni, posFin], o -1 si no hubo memoria
+*/
+long long mergeSortConInversiones(int *arregloDes, int posIni, int posFin) {
+    if (posIni >= posFin) {
+        return 0;
+    }
+    int l = posFin - posIni + 1;
     int *arregloAux = malloc(l * sizeof(int));
+    if (arregloAux == NULL) {
+        return -1;
+    }
+    // El auxiliar se indexa igual que arregloDes para compartir posIni y posFin
+    int *auxiliar = arregloAux - posIni;
+    memcpy(arregloAux, arregloDes + posIni, l * sizeof(int));
+    long long inversiones = ordenarPingPong(auxiliar, arregloDes, posIni, posFin);
+    free(arregloAux);
+    return inversiones;
+}
 
-    for(k = 0; k <= (l - 1); k++){
-        if(i <= mitad && j <= posFin){
-            if(arregloDes[i] <= arregloDes[j]){
-                arregloAux[k] = arregloDes[i];
-                i++;
-            }else{
-                // Si tomamos un elemento de la derecha, significa que
-                // TODOS los elementos restantes de la izquierda (desde i hasta mitad)
-                // son mayores y forman inversiones
-                arregloAux[k] = arregloDes[j];
-                inversiones_totales += (mitad - i + 1);  // Contar inversiones
-                j++;
-            }
-        } else if(i <= mitad){
-            arregloAux[k] = arregloDes[i];
-            i++;
-        } else{
-            arregloAux[k] = arregloDes[j];
-            j++;
+/*
+mergeSortIterativo - Merge sort de abajo hacia arriba (sin recursión)
+Primero ordena por inserción bloques de UMBRAL_INSERCION elementos y después mezcla
+bloques de ancho 2, 4, 8... alternando entre el arreglo y un único auxiliar. Si el número
+de pasadas es impar, el resultado termina en el auxiliar y se copia una sola vez al final.
+Regresa el número de inversiones, o -1 si no hubo memoria
+*/
+long long mergeSortIterativo(int *arregloDes, int n) {
+    long long inversiones = 0;
+    // Los índices se calculan en long long: con n cerca de INT_MAX, ini + 2 * ancho no cabe en int
+    for (long long ini = 0; ini < n; ini += UMBRAL_INSERCION) {
+        int fin = (int)((ini + UMBRAL_INSERCION - 1 < n - 1) ? ini + UMBRAL_INSERCION - 1 : n - 1);
+        inversiones += insercionConInversiones(arregloDes, (int)ini, fin);
+    }
+    if (n <= UMBRAL_INSERCION) {
+        return inversiones;
+    }
+
+    int *arregloAux = malloc(n * sizeof(int));
+    if (arregloAux == NULL) {
+        return -1;
+    }
+    int *origen = arregloDes, *destino = arregloAux;
+    for (long long ancho = UMBRAL_INSERCION; ancho < n; ancho *= 2) {
+        for (long long ini = 0; ini < n; ini += 2 * ancho) {
+            int mitad = (int)((ini + ancho - 1 < n - 1) ? ini + ancho - 1 : n - 1);
+            int fin = (int)((ini + 2 * ancho - 1 < n - 1) ? ini + 2 * ancho - 1 : n - 1);
+            // Si no hay mitad derecha, mezclarRangos solo copia el bloque
+            inversiones += mezclarRangosConInversiones(origen, (int)ini, mitad, mitad + 1, fin, destino, (int)ini);
         }
+        int *temp = origen;
+        origen = destino;
+        destino = temp;
     }
-    
-    k = posIni;
-    for(int i = 0; i < l; i++){
-        arregloDes[k] = arregloAux[i]; 
-        k++;
+    if (origen != arregloDes) {
+        memcpy(arregloDes, origen, n * sizeof(int));
+    }
+    free(arregloAux);
+    return inversiones;
+}
+
+/*
+busquedaLimite - Primer índice en arreglo[ini..fin] cuyo valor es mayor que valor
+(o mayor o igual si estricto == false). Regresa fin + 1 si no existe.
+*/
+int busquedaLimite(const int *arreglo, int ini, int fin, int valor, bool estricto) {
+    fin++;
+    while (ini < fin) {
+        int mitad = ini + (fin - ini) / 2;
+        if (arreglo[mitad] < valor || (estricto && arreglo[mitad] == valor)) {
+            ini = mitad + 1;
+        } else {
+            fin = mitad;
+        }
+    }
+    return ini;
+}
+
+// Datos de una mezcla paralela que se delega a otro hilo
+typedef struct {
+    const int *origen;
+    int iniA, finA, iniB, finB;
+    int *destino;
+    int posDestino;
+    int profundidad;
+    long long inversiones;   // Resultado de la tarea
+} TareaMezcla;
+
+void *ejecutarTareaMezcla(void *arg);
+
+/*
+mezclaParalelaConInversiones - Mezcla dos rangos ordenados repartiendo el trabajo entre hilos
+Se toma como pivote el elemento central del rango más grande y se busca su posición en el otro
+rango con búsqueda binaria. Eso parte A en A1|A2 y B en B1|B2 de forma que todo A1 ∪ B1 va antes
+que A2 ∪ B2 en la salida, y las dos mezclas resultantes son independientes.
+Con esa partición todo elemento de A2 es mayor que todo elemento de B1 y ningún par de A1 × B2
+es inversión, así que:
+    inversiones(A, B) = inversiones(A1, B1) + inversiones(A2, B2) + |A2| * |B1|
+*/
+long long mezclaParalelaConInversiones(const int *origen, int iniA, int finA, int iniB, int finB,
+                                       int *destino, int posDestino, int profundidad) {
+    int lonA = finA - iniA + 1, lonB = finB - iniB + 1;
+    if (profundidad <= 0 || lonA + lonB < GRANO_PARALELO || lonA == 0 || lonB == 0) {
+        return mezclarRangosConInversiones(origen, iniA, finA, iniB, finB, destino, posDestino);
     }
 
+    int corteA, corteB;  // Primer índice de A2 y de B2
+    if (lonA >= lonB) {
+        // A1 <= x, A2 >= x, B1 < x, B2 >= x
+        corteA = iniA + lonA / 2;
+        corteB = busquedaLimite(origen, iniB, finB, origen[corteA], false);
+    } else {
+        // B1 <= y, B2 >= y, A1 <= y, A2 > y
+        corteB = iniB + lonB / 2;
+        corteA = busquedaLimite(origen, iniA, finA, origen[corteB], true);
+    }
+    long long cruzadas = (long long)(finA - corteA + 1) * (corteB - iniB);
+
+    // La primera mitad de la mezcla va a otro hilo y la segunda se hace en este
+    TareaMezcla tarea = {origen, iniA, corteA - 1, iniB, corteB - 1, destino, posDestino, profundidad - 1, 0};
+    pthread_t hilo;
+    bool conHilo = pthread_create(&hilo, NULL, ejecutarTareaMezcla, &tarea) == 0;
+    if (!conHilo) {
+        ejecutarTareaMezcla(&tarea);
+    }
+
+    int posSegunda = posDestino + (corteA - iniA) + (corteB - iniB);
+    long long inversiones = mezclaParalelaConInversiones(origen, corteA, finA, corteB, finB,
+                                                         destino, posSegunda, profundidad - 1);
+    if (conHilo) {
+        pthread_join(hilo, NULL);
+    }
+    return inversiones + tarea.inversiones + cruzadas;
+}
+
+void *ejecutarTareaMezcla(void *arg) {
+    TareaMezcla *tarea = (TareaMezcla *)arg;
+    tarea->inversiones = mezclaParalelaConInversiones(tarea->origen, tarea->iniA, tarea->finA,
+                                                      tarea->iniB, tarea->finB, tarea->destino,
+                                                      tarea->posDestino, tarea->profundidad);
+    return NULL;
+}
+
+// Datos de un ordenamiento paralelo que se delega a otro hilo
+typedef struct {
+    int *origen;
+    int *destino;
+    int posIni, posFin;
+    int profundidad;
+    long long inversiones;   // Resultado de la tarea
+} TareaMergeSort;
+
+long long ordenarPingPongParalelo(int *origen, int *destino, int posIni, int posFin, int profundidad);
+
+void *ejecutarTareaMergeSort(void *arg) {
+    TareaMergeSort *tarea = (TareaMergeSort *)arg;
+    tarea->inversiones = ordenarPingPongParalelo(tarea->origen, tarea->destino, tarea->posIni,
+                                                 tarea->posFin, tarea->profundidad);
+    return NULL;
+}
+
+/*
+ordenarPingPongParalelo - ordenarPingPong repartido entre hilos
+En los primeros `profundidad` niveles la mitad izquierda se ordena en un hilo nuevo mientras
+este hilo ordena la derecha, y la mezcla de esos niveles también es paralela. Por debajo de
+GRANO_PARALELO elementos, o al agotar la profundidad, se usa ordenarPingPong.
+Cada tarea regresa sus propias inversiones, no hay estado compartido entre hilos, y todas
+trabajan sobre rangos disjuntos del mismo par de arreglos.
+*/
+long long ordenarPingPongParalelo(int *origen, int *destino, int posIni, int posFin, int profundidad) {
+    if (profundidad <= 0 || posFin - posIni + 1 < GRANO_PARALELO) {
+        return ordenarPingPong(origen, destino, posIni, posFin);
+    }
+
+    int mitad = (posIni + posFin) / 2;
+    TareaMergeSort tarea = {destino, origen, posIni, mitad, profundidad - 1, 0};
+    pthread_t hilo;
+    bool conHilo = pthread_create(&hilo, NULL, ejecutarTareaMergeSort, &tarea) == 0;
+    if (!conHilo) {
+        ejecutarTareaMergeSort(&tarea);
+    }
+    long long inversiones = ordenarPingPongParalelo(destino, origen, mitad + 1, posFin, profundidad - 1);
+    if (conHilo) {
+        pthread_join(hilo, NULL);
+    }
+    inversiones += tarea.inversiones;
+
+    inversiones += mezclaParalelaConInversiones(origen, posIni, mitad, mitad + 1, posFin,
+                                                destino, posIni, profundidad);
+    return inversiones;
+}
+
+/*
+mergeSortParalelo - Merge sort paralelo con conteo de inversiones
+Igual que mergeSortConInversiones, un solo auxiliar para todo el ordenamiento.
+Regresa el número de inversiones, o -1 si no hubo memoria
+*/
+long long mergeSortParalelo(int *arregloDes, int n, int profundidad) {
+    if (n < 2) {
+        return 0;
+    }
+    int *arregloAux = malloc(n * sizeof(int));
+    if (arregloAux == NULL) {
+        return -1;
+    }
+    memcpy(arregloAux, arregloDes, n * sizeof(int));
+    long long inversiones = ordenarPingPongParalelo(arregloAux, arregloDes, 0, n - 1, profundidad);
     free(arregloAux);
+    return inversiones;
 }
 
 /*
-mergeSortConInversiones - Versión que cuenta inversiones
+MODO EXTERNO: conteo de inversiones para entradas más grandes que la memoria
+1. Se lee la entrada en bloques que caben en el presupuesto de memoria; cada bloque se
+   ordena con mergeSortConInversiones (inversiones dentro del bloque) y se escribe como
+   una corrida ordenada en un archivo temporal.
+2. Las k corridas se mezclan con un montículo de mínimos. Al sacar un valor v de la corrida r,
+   los elementos que aún no salen de las corridas 0..r-1 vienen antes que v en la entrada y
+   son estrictamente mayores que v (en empates sale primero la corrida de menor índice), así
+   que cada uno forma una inversión con v. Esa cantidad se obtiene con un árbol de Fenwick
+   sobre lo que le resta a cada corrida.
+Todos los tamaños y contadores son de 64 bits; solo el tamaño de un bloque se limita a
+MAX_ELEMENTOS_BLOQUE porque el ordenamiento en memoria indexa con int.
 */
-void mergeSortConInversiones(int *arregloDes, int posIni, int posFin) {
-    if (posIni < posFin){
-        int mitad = (posIni + posFin) / 2;
-        
-        // Ordenar y contar inversiones en mitad izquierda
-        mergeSortConInversiones(arregloDes, posIni, mitad);
-        
-        // Ordenar y contar inversiones en mitad derecha
-        mergeSortConInversiones(arregloDes, mitad + 1, posFin);
-        
-        // Mezclar y contar inversiones entre mitades
-        MergeConInversiones(arregloDes, posIni, mitad, posFin);
+
+// Mayor bloque que se ordena en memoria (los índices del merge sort son int)
+#define MAX_ELEMENTOS_BLOQUE (1 << 30)
+
+// Elementos mínimos del búfer de lectura de cada corrida durante la mezcla
+#define MIN_BUFER_CORRIDA 1024
+
+// Corrida ordenada guardada en un archivo temporal
+typedef struct {
+    FILE *archivo;
+    int *bufer;
+    long long capacidad;   // Elementos que caben en bufer
+    long long pos, lon;    // Posición actual y elementos válidos en bufer
+    long long restantes;   // Elementos de la corrida que aún no salen de la mezcla
+} CorridaExterna;
+
+// Resultado del conteo externo
+typedef struct {
+    long long inversiones;
+    long long elementos;
+    long long corridas;
+} ResultadoExterno;
+
+/*
+siguienteDeCorrida - Entrega el siguiente valor de la corrida, recargando su búfer si hace falta
+*/
+bool siguienteDeCorrida(CorridaExterna *corrida, int *valor) {
+    if (corrida->pos == corrida->lon) {
+        corrida->lon = (long long)fread(corrida->bufer, sizeof(int), (size_t)corrida->capacidad, corrida->archivo);
+        corrida->pos = 0;
+        if (corrida->lon == 0) {
+            return false;
+        }
     }
+    *valor = corrida->bufer[corrida->pos++];
+    return true;
+}
+
+/*
+Árbol de Fenwick sobre las corridas: arbol[1..k] guarda cuántos elementos le quedan a cada una
+*/
+void fenwickSumar(long long *arbol, long long k, long long pos, long long valor) {
+    for (pos++; pos <= k; pos += pos & -pos) {
+        arbol[pos] += valor;
+    }
+}
+
+long long fenwickPrefijo(const long long *arbol, long long pos) {
+    long long suma = 0;
+    for (; pos > 0; pos -= pos & -pos) {
+        suma += arbol[pos];
+    }
+    return suma;
+}
+
+/*
+Montículo de mínimos de (valor, corrida); en empates va primero la corrida de menor índice
+*/
+typedef struct {
+    int valor;
+    long long corrida;
+} NodoMezcla;
+
+bool nodoMenor(NodoMezcla a, NodoMezcla b) {
+    return a.valor < b.valor || (a.valor == b.valor && a.corrida < b.corrida);
+}
+
+void hundirNodo(NodoMezcla *monticulo, long long n, long long i) {
+    NodoMezcla nodo = monticulo[i];
+    long long hijo;
+    while ((hijo = 2 * i + 1) < n) {
+        if (hijo + 1 < n && nodoMenor(monticulo[hijo + 1], monticulo[hijo])) {
+            hijo++;
+        }
+        if (!nodoMenor(monticulo[hijo], nodo)) {
+            break;
+        }
+        monticulo[i] = monticulo[hijo];
+        i = hijo;
+    }
+    monticulo[i] = nodo;
+}
+
+/*
+escribirSalida - Escribe un bloque del resultado ordenado en binario (".i32") o texto
+Regresa false si no se pudo escribir completo (disco lleno, tubería cerrada)
+*/
+bool escribirSalida(FILE *salida, bool binario, const int *bloque, long long n) {
+    if (binario) {
+        return fwrite(bloque, sizeof(int), (size_t)n, salida) == (size_t)n;
+    }
+    for (long long i = 0; i < n; i++) {
+        if (fprintf(salida, "%d\n", bloque[i]) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*
+conteoInversionesExterno - Cuenta las inversiones de la entrada sin cargarla completa
+rutaEntrada: archivo de texto o ".i32" (NULL para la entrada estándar)
+limite: máximo de elementos a leer (0 para leer hasta el final)
+memoriaBytes: presupuesto de memoria para los bloques y los búferes de la mezcla
+rutaSalida: si no es NULL, ahí se escribe la entrada ordenada
+Regresa false si no se pudo abrir algún archivo, reservar memoria o escribir la salida completa
+*/
+bool conteoInversionesExterno(const char *rutaEntrada, long long limite, long long memoriaBytes,
+                              const char *rutaSalida, ResultadoExterno *resultado) {
+    resultado->inversiones = 0;
+    resultado->elementos = 0;
+    resultado->corridas = 0;
+
+    // Bloque + auxiliar del merge sort: 2 enteros por elemento
+    long long tamBloque = memoriaBytes / (2 * (long long)sizeof(int));
+    if (tamBloque > MAX_ELEMENTOS_BLOQUE) {
+        tamBloque = MAX_ELEMENTOS_BLOQUE;
+    }
+    if (tamBloque < MIN_BUFER_CORRIDA) {
+        tamBloque = MIN_BUFER_CORRIDA;
+    }
+
+    FuenteEnteros fuente;
+    if (!fuenteAbrir(&fuente, rutaEntrada)) {
+        return false;
+    }
+    int *bloque = malloc((size_t)tamBloque * sizeof(int));
+    long long capacidadCorridas = 16;
+    CorridaExterna *corridas = malloc((size_t)capacidadCorridas * sizeof(CorridaExterna));
+    if (bloque == NULL || corridas == NULL) {
+        fuenteCerrar(&fuente);
+        free(bloque);
+        free(corridas);
+        return false;
+    }
+
+    // FASE 1: ordenar bloques, contar sus inversiones internas y guardarlos como corridas
+    bool ok = true;
+    long long k = 0;
+    for (;;) {
+        long long porLeer = tamBloque;
+        if (limite > 0 && limite - resultado->elementos < porLeer) {
+            porLeer = limite - resultado->elementos;
+        }
+        long long leidos = porLeer > 0 ? fuenteLeer(&fuente, bloque, porLeer) : 0;
+        if (leidos == 0) {
+            break;
+        }
+        long long internas = mergeSortConInversiones(bloque, 0, (int)leidos - 1);
+        FILE *temporal = tmpfile();
+        if (internas < 0 || temporal == NULL) {
+            ok = false;
+            break;
+        }
+        if (fwrite(bloque, sizeof(int), (size_t)leidos, temporal) != (size_t)leidos) {
+            fclose(temporal);
+            ok = false;
+            break;
+        }
+        rewind(temporal);
+
+        if (k == capacidadCorridas) {
+            capacidadCorridas *= 2;
+            CorridaExterna *nuevas = realloc(corridas, (size_t)capacidadCorridas * sizeof(CorridaExterna));
+            if (nuevas == NULL) {
+                fclose(temporal);
+                ok = false;
+                break;
+            }
+            corridas = nuevas;
+        }
+        corridas[k].archivo = temporal;
+        corridas[k].restantes = leidos;
+        corridas[k].bufer = NULL;
+        k++;
+        resultado->inversiones += internas;
+        resultado->elementos += leidos;
+    }
+    fuenteCerrar(&fuente);
+    free(bloque);
+    resultado->corridas = k;
+
+    // FASE 2: mezcla de k vías contando inversiones entre corridas
+    FILE *salida = NULL;
+    bool salidaBinaria = rutaSalida != NULL && esArchivoBinario(rutaSalida);
+    if (ok && rutaSalida != NULL) {
+        salida = fopen(rutaSalida, salidaBinaria ? "wb" : "w");
+        ok = salida != NULL;
+    }
+
+    long long capacidadBufer = memoriaBytes / (long long)sizeof(int) / (k + 1);
+    if (capacidadBufer < MIN_BUFER_CORRIDA) {
+        capacidadBufer = MIN_BUFER_CORRIDA;
+    }
+    NodoMezcla *monticulo = malloc((size_t)(k + 1) * sizeof(NodoMezcla));
+    long long *arbol = calloc((size_t)(k + 1), sizeof(long long));
+    int *bufSalida = malloc((size_t)capacidadBufer * sizeof(int));
+    ok = ok && monticulo != NULL && arbol != NULL && bufSalida != NULL;
+    for (long long r = 0; ok && r < k; r++) {
+        corridas[r].bufer = malloc((size_t)capacidadBufer * sizeof(int));
+        corridas[r].capacidad = capacidadBufer;
+        corridas[r].pos = corridas[r].lon = 0;
+        ok = corridas[r].bufer != NULL;
+    }
+
+    if (ok) {
+        long long tam = 0;
+        for (long long r = 0; r < k; r++) {
+            fenwickSumar(arbol, k, r, corridas[r].restantes);
+            if (siguienteDeCorrida(&corridas[r], &monticulo[tam].valor)) {
+                monticulo[tam].corrida = r;
+                tam++;
+            }
+        }
+        for (long long i = tam / 2 - 1; i >= 0; i--) {
+            hundirNodo(monticulo, tam, i);
+        }
+
+        long long enSalida = 0;
+        while (ok && tam > 0) {
+            NodoMezcla menor = monticulo[0];
+            long long r = menor.corrida;
+
+            // Lo que queda en las corridas anteriores es mayor que menor.valor
+            fenwickSumar(arbol, k, r, -1);
+            resultado->inversiones += fenwickPrefijo(arbol, r);
+
+            if (salida != NULL) {
+                bufSalida[enSalida++] = menor.valor;
+                if (enSalida == capacidadBufer) {
+                    ok = escribirSalida(salida, salidaBinaria, bufSalida, enSalida);
+                    enSalida = 0;
+                }
+            }
+
+            if (siguienteDeCorrida(&corridas[r], &monticulo[0].valor)) {
+                monticulo[0].corrida = r;
+            } else {
+                monticulo[0] = monticulo[--tam];
+            }
+            hundirNodo(monticulo, tam, 0);
+        }
+        if (ok && salida != NULL) {
+            ok = escribirSalida(salida, salidaBinaria, bufSalida, enSalida);
+        }
+    }
+
+    // Los errores de escritura que quedaron en el búfer de stdio aparecen hasta ferror o fclose
+    if (salida != NULL) {
+        ok = !ferror(salida) && ok;
+        ok = fclose(salida) == 0 && ok;
+    }
+    for (long long r = 0; r < k; r++) {
+        fclose(corridas[r].archivo);   // tmpfile() se borra al cerrarse
+        free(corridas[r].bufer);
+    }
+    free(corridas);
+    free(monticulo);
+    free(arbol);
+    free(bufSalida);
+    return ok;
 }
 
 int main(int num_arg, char *arg_user[]) {
 
-    if (num_arg != 2) {
-        printf("\nUso: %s [cantidad_elementos] < archivo.txt\n", arg_user[0]);
+    if (num_arg < 2) {
+        printf("\nUso: %s [cantidad_elementos] [--entrada archivo] [--hilos k] [--iterativo] [--silencioso] < archivo.txt\n", arg_user[0]);
+        printf("     %s [cantidad_elementos] --externo [--memoria MB] [--entrada archivo] [--salida archivo]\n", arg_user[0]);
         printf("Ejemplo: ./merge 10 < numeros.txt\n");
         exit(1);
     } 
 
-    int fin = atoi(arg_user[1]);
+    // La cantidad de elementos es el primer argumento, salvo en modo externo donde es opcional
+    int primeraOpcion = 1;
+    long long cantidad = 0;
+    if (strncmp(arg_user[1], "--", 2) != 0) {
+        cantidad = atoll(arg_user[1]);
+        primeraOpcion = 2;
+    }
+
+    const char *rutaEntrada = NULL;
+    const char *rutaSalida = NULL;
+    int hilos = numeroNucleos();
+    bool silencioso = false;
+    bool iterativo = false;
+    bool externo = false;
+    long long memoriaMB = 256;
+    bool generar = false;
+    ClaseEntrada clase = CLASE_ALEATORIOS;
+    unsigned long long semilla = 1;
+    long long desplazados = DESPLAZADOS_POR_DEFECTO;
+    for (int i = primeraOpcion; i < num_arg; i++) {
+        if (strcmp(arg_user[i], "--entrada") == 0 && i + 1 < num_arg) {
+            rutaEntrada = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--hilos") == 0 && i + 1 < num_arg) {
+            hilos = atoi(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--silencioso") == 0) {
+            silencioso = true;
+        } else if (strcmp(arg_user[i], "--iterativo") == 0) {
+            iterativo = true;
+        } else if (strcmp(arg_user[i], "--externo") == 0) {
+            externo = true;
+        } else if (strcmp(arg_user[i], "--memoria") == 0 && i + 1 < num_arg) {
+            memoriaMB = atoll(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--salida") == 0 && i + 1 < num_arg) {
+            rutaSalida = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--generar") == 0 && i + 1 < num_arg && claseDesdeTexto(arg_user[i + 1], &clase)) {
+            generar = true;
+            i++;
+        } else if (strcmp(arg_user[i], "--semilla") == 0 && i + 1 < num_arg) {
+            semilla = strtoull(arg_user[++i], NULL, 10);
+        } else if (strcmp(arg_user[i], "--desplazados") == 0 && i + 1 < num_arg) {
+            desplazados = atoll(arg_user[++i]);
+        } else {
+            printf("Opcion no reconocida: %s\n", arg_user[i]);
+            exit(1);
+        }
+    }
+    if (hilos < 1) {
+        hilos = 1;
+    }
+
+    if (externo && generar) {
+        printf("Error: --generar no se puede combinar con --externo (los datos generados ya estan en memoria)\n");
+        exit(1);
+    }
+
+    if (externo) {
+        if (memoriaMB < 1) {
+            memoriaMB = 1;
+        }
+        ResultadoExterno resultado;
+        double inicio = tiempoMonotonico();
+        if (!conteoInversionesExterno(rutaEntrada, cantidad, memoriaMB * 1024 * 1024, rutaSalida, &resultado)) {
+            printf("Error: No se pudo completar el conteo externo (archivos, memoria o escritura de la salida)\n");
+            exit(1);
+        }
+        double transcurrido = tiempoMonotonico() - inicio;
+        printf("Elementos: %lld\n", resultado.elementos);
+        printf("Corridas temporales: %lld\n", resultado.corridas);
+        printf("Numero total de inversiones: %lld\n", resultado.inversiones);
+        printf("Tiempo total (lectura, ordenamiento y mezcla): %f segundos\n", transcurrido);
+        return 0;
+    }
+
+    if (cantidad <= 0 || cantidad > 2147483647LL) {
+        printf("Error: la cantidad de elementos debe estar entre 1 y 2147483647 (use --externo para mas)\n");
+        exit(1);
+    }
+    int fin = (int)cantidad;
     
     int *arreglo = malloc(fin * sizeof(int));
     
@@ -89,27 +711,59 @@ int main(int num_arg, char *arg_user[]) {
         exit(1);
     }
     
-    // Leer n valores
-    for (int i = 0; i < fin; i++) {
-        scanf("%d", &arreglo[i]);
+    // Leer (o generar) n valores en bloque; el tiempo de lectura se reporta aparte del ordenamiento
+    clock_t t = clock();
+    long long leidos;
+    if (generar) {
+        if (!generarEnteros(arreglo, fin, clase, semilla, desplazados)) {
+            printf("Error: No se pudo asignar memoria\n");
+            exit(1);
+        }
+        leidos = fin;
+    } else {
+        leidos = cargarEnteros(rutaEntrada, arreglo, fin);
+    }
+    t = clock() - t;
+    if (leidos < fin) {
+        printf("Error: Solo se leyeron %lld de %d enteros\n", leidos < 0 ? 0 : leidos, fin);
+        exit(1);
     }
+    printf("%s de datos: %f segundos\n\n", generar ? "Generacion" : "Lectura", ((double)t) / CLOCKS_PER_SEC);
     
-    printf("Arreglo antes del ordenamiento: \n");
-    for (int i = 0; i < fin; i++) {
-        printf("%d ", arreglo[i]);
+    if (!silencioso) {
+        printf("Arreglo antes del ordenamiento: \n");
+        for (int i = 0; i < fin; i++) {
+            printf("%d ", arreglo[i]);
+        }
+        printf("\n\n");
     }
-    printf("\n\n");
     
     // Opción 2: Ordenar Y contar inversiones
-    inversiones_totales = 0;  // Reiniciar contador
-    mergeSortConInversiones(arreglo, 0, fin - 1);
-    printf("Numero total de inversiones: %lld\n\n", inversiones_totales);
+    double inicio = tiempoMonotonico();
+    long long inversiones_totales;
+    if (iterativo) {
+        hilos = 1;
+        inversiones_totales = mergeSortIterativo(arreglo, fin);
+    } else if (hilos == 1) {
+        inversiones_totales = mergeSortConInversiones(arreglo, 0, fin - 1);
+    } else {
+        inversiones_totales = mergeSortParalelo(arreglo, fin, profundidadParaHilos(hilos));
+    }
+    double transcurrido = tiempoMonotonico() - inicio;
+    if (inversiones_totales < 0) {
+        printf("Error: No se pudo asignar memoria para el arreglo auxiliar\n");
+        exit(1);
+    }
+    printf("Numero total de inversiones: %lld\n", inversiones_totales);
+    printf("Tiempo de ordenamiento: %f segundos (%d hilos)\n\n", transcurrido, hilos);
     
-    printf("Arreglo despues del ordenamiento: \n");
-    for (int i = 0; i < fin; i++) {
-        printf("%d ", arreglo[i]);
+    if (!silencioso) {
+        printf("Arreglo despues del ordenamiento: \n");
+        for (int i = 0; i < fin; i++) {
+            printf("%d ", arreglo[i]);
+        }
+        printf("\n");
     }
-    printf("\n");
     
     free(arreglo);
     
@@ -0,0 +1,564 @@
+/*
+  Conteo de inversiones en línea (flujo de datos)
+
+  A diferencia de conteoInversiones.c, que necesita el arreglo completo y lo reordena,
+  aquí los valores se procesan conforme llegan y después de cada inserción se conoce
+  el número de inversiones acumulado. También se puede contar solo sobre una ventana
+  deslizante con los últimos w valores, sin volver a ordenar nada.
+
+  Al insertar v, las nuevas inversiones son los valores ya vistos mayores que v.
+  Al sacar de la ventana al valor más antiguo u, se pierden las inversiones que formaba
+  con los valores posteriores menores que él. Ambas cantidades se obtienen con una
+  estructura de estadísticos de orden:
+   - Árbol de Fenwick sobre los valores comprimidos, cuando se conoce de antemano el
+     conjunto de valores posibles (--dominio). O(log d) por operación.
+   - Treap con tamaños de subárbol cuando los valores son desconocidos. O(log n) esperado.
+
+  Compilación: gcc inversionesEnLinea.c -o inversionesEnLinea
+  Ejecución: ./inversionesEnLinea [opciones] < flujo.txt
+  Opciones:
+    --entrada {archivo}   Lee de un archivo de texto o ".i32" en lugar de la entrada estándar
+    --dominio {archivo}   Valores posibles del flujo; activa el árbol de Fenwick
+    --ventana {w}         Cuenta inversiones solo entre los últimos w valores
+    --cada {k}            Reporta cada k inserciones (por defecto 1)
+    --en-vivo             Procesa la entrada línea por línea y vacía la salida en cada
+                          reporte, para conectarlo a un flujo que no termina
+  Salida: una línea "elementos inversiones" por reporte.
+  Ejemplo:
+             tail -f eventos.log | ./inversionesEnLinea --en-vivo --ventana 10000 --cada 1000
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <limits.h>
+#include "../Comun/lecturaEnteros.h"
+
+// Tamaño del bloque de valores que se procesa de una vez cuando no es en vivo
+#define BLOQUE_FLUJO 4096
+
+// Caracteres de un token en vivo; un int con signo ocupa a lo más 11
+#define TAM_MAXIMO_TOKEN 23
+
+/*
+ARBOL DE FENWICK con compresión de coordenadas
+dominio[0..tamDominio-1] tiene los valores posibles ordenados y sin repetir;
+arbol[i] (1..tamDominio) cuenta los valores presentes según la regla de Fenwick
+*/
+typedef struct {
+    int *dominio;
+    int tamDominio;
+    long long *arbol;
+} ArbolFenwick;
+
+int compararEnteros(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+fenwickCrear - Ordena y quita repetidos de los valores posibles y reserva el árbol
+Toma posesión de valores. Regresa false si no hubo memoria
+*/
+bool fenwickCrear(ArbolFenwick *f, int *valores, int n) {
+    qsort(valores, n, sizeof(int), compararEnteros);
+    int unicos = 0;
+    for (int i = 0; i < n; i++) {
+        if (unicos == 0 || valores[i] != valores[unicos - 1]) {
+            valores[unicos++] = valores[i];
+        }
+    }
+    f->dominio = valores;
+    f->tamDominio = unicos;
+    f->arbol = calloc(unicos + 1, sizeof(long long));
+    return f->arbol != NULL;
+}
+
+/*
+fenwickPosicion - Índice (1..tamDominio) del valor dentro del dominio, o 0 si no pertenece
+*/
+int fenwickPosicion(const ArbolFenwick *f, int valor) {
+    int ini = 0, fin = f->tamDominio;
+    while (ini < fin) {
+        int mitad = ini + (fin - ini) / 2;
+        if (f->dominio[mitad] < valor) {
+            ini = mitad + 1;
+        } else {
+            fin = mitad;
+        }
+    }
+    return (ini < f->tamDominio && f->dominio[ini] == valor) ? ini + 1 : 0;
+}
+
+void fenwickSumar(ArbolFenwick *f, int pos, long long valor) {
+    for (; pos <= f->tamDominio; pos += pos & -pos) {
+        f->arbol[pos] += valor;
+    }
+}
+
+// Cuántos valores presentes tienen índice <= pos
+long long fenwickPrefijo(const ArbolFenwick *f, int pos) {
+    long long suma = 0;
+    for (; pos > 0; pos -= pos & -pos) {
+        suma += f->arbol[pos];
+    }
+    return suma;
+}
+
+void fenwickLiberar(ArbolFenwick *f) {
+    free(f->dominio);
+    free(f->arbol);
+}
+
+/*
+TREAP DE ESTADÍSTICOS DE ORDEN
+Árbol binario de búsqueda por valor y montículo por prioridad aleatoria. Cada nodo guarda
+cuántas veces aparece su valor y el total de elementos de su subárbol, con lo que se
+cuentan los menores o mayores que un valor en O(log n) esperado.
+Los nodos viven en un arreglo que crece con realloc; los índices sustituyen a punteros y
+los nodos que se liberan se reutilizan con una lista de libres.
+*/
+typedef struct {
+    int valor;
+    int repeticiones;
+    long long tam;        // Elementos en el subárbol (contando repeticiones)
+    unsigned prioridad;
+    int izq, der;         // Índices de los hijos, -1 si no hay
+} NodoTreap;
+
+typedef struct {
+    NodoTreap *nodos;
+    int capacidad;
+    int usados;
+    int libre;            // Cabeza de la lista de nodos libres (encadenados por izq), -1 si vacía
+    int raiz;
+    unsigned semilla;
+} Treap;
+
+void treapCrear(Treap *t) {
+    t->nodos = NULL;
+    t->capacidad = 0;
+    t->usados = 0;
+    t->libre = -1;
+    t->raiz = -1;
+    t->semilla = 2463534242u;
+}
+
+long long treapTam(const Treap *t, int nodo) {
+    return nodo < 0 ? 0 : t->nodos[nodo].tam;
+}
+
+void treapActualizar(Treap *t, int nodo) {
+    NodoTreap *n = &t->nodos[nodo];
+    n->tam = n->repeticiones + treapTam(t, n->izq) + treapTam(t, n->der);
+}
+
+// Generador xorshift32 para las prioridades
+unsigned treapAleatorio(Treap *t) {
+    t->semilla ^= t->semilla << 13;
+    t->semilla ^= t->semilla >> 17;
+    t->semilla ^= t->semilla << 5;
+    return t->semilla;
+}
+
+/*
+treapNuevoNodo - Toma un nodo de la lista de libres o del final del arreglo; -1 si no hay memoria
+*/
+int treapNuevoNodo(Treap *t, int valor) {
+    int nodo;
+    if (t->libre >= 0) {
+        nodo = t->libre;
+        t->libre = t->nodos[nodo].izq;
+    } else {
+        if (t->usados == t->capacidad) {
+            int nuevaCapacidad = t->capacidad ? 2 * t->capacidad : 1024;
+            NodoTreap *nuevos = realloc(t->nodos, nuevaCapacidad * sizeof(NodoTreap));
+            if (nuevos == NULL) {
+                return -1;
+            }
+            t->nodos = nuevos;
+            t->capacidad = nuevaCapacidad;
+        }
+        nodo = t->usados++;
+    }
+    NodoTreap *n = &t->nodos[nodo];
+    n->valor = valor;
+    n->repeticiones = 1;
+    n->tam = 1;
+    n->prioridad = treapAleatorio(t);
+    n->izq = n->der = -1;
+    return nodo;
+}
+
+int treapRotarDerecha(Treap *t, int nodo) {
+    int hijo = t->nodos[nodo].izq;
+    t->nodos[nodo].izq = t->nodos[hijo].der;
+    t->nodos[hijo].der = nodo;
+    treapActualizar(t, nodo);
+    treapActualizar(t, hijo);
+    return hijo;
+}
+
+int treapRotarIzquierda(Treap *t, int nodo) {
+    int hijo = t->nodos[nodo].der;
+    t->nodos[nodo].der = t->nodos[hijo].izq;
+    t->nodos[hijo].izq = nodo;
+    treapActualizar(t, nodo);
+    treapActualizar(t, hijo);
+    return hijo;
+}
+
+/*
+treapInsertarEn - Inserta valor en el subárbol de nodo y regresa la nueva raíz del subárbol
+*ok queda en false si no hubo memoria
+*/
+int treapInsertarEn(Treap *t, int nodo, int valor, bool *ok) {
+    if (nodo < 0) {
+        int nuevo = treapNuevoNodo(t, valor);
+        *ok = nuevo >= 0;
+        return nuevo;
+    }
+    if (valor == t->nodos[nodo].valor) {
+        t->nodos[nodo].repeticiones++;
+    } else if (valor < t->nodos[nodo].valor) {
+        int hijo = treapInsertarEn(t, t->nodos[nodo].izq, valor, ok);
+        t->nodos[nodo].izq = hijo;
+        if (hijo >= 0 && t->nodos[hijo].prioridad > t->nodos[nodo].prioridad) {
+            treapActualizar(t, nodo);
+            return treapRotarDerecha(t, nodo);
+        }
+    } else {
+        int hijo = treapInsertarEn(t, t->nodos[nodo].der, valor, ok);
+        t->nodos[nodo].der = hijo;
+        if (hijo >= 0 && t->nodos[hijo].prioridad > t->nodos[nodo].prioridad) {
+            treapActualizar(t, nodo);
+            return treapRotarIzquierda(t, nodo);
+        }
+    }
+    treapActualizar(t, nodo);
+    return nodo;
+}
+
+/*
+treapEliminarEn - Quita una aparición de valor del subárbol de nodo y regresa la nueva raíz
+*/
+int treapEliminarEn(Treap *t, int nodo, int valor) {
+    if (nodo < 0) {
+        return -1;
+    }
+    NodoTreap *n = &t->nodos[nodo];
+    if (valor < n->valor) {
+        n->izq = treapEliminarEn(t, n->izq, valor);
+    } else if (valor > n->valor) {
+        n->der = treapEliminarEn(t, n->der, valor);
+    } else if (n->repeticiones > 1) {
+        n->repeticiones--;
+    } else {
+        // Bajar el nodo rotando hacia el hijo de mayor prioridad hasta que sea hoja
+        if (n->izq < 0 && n->der < 0) {
+            n->izq = t->libre;
+            t->libre = nodo;
+            return -1;
+        }
+        int raiz;
+        if (n->der < 0 || (n->izq >= 0 && t->nodos[n->izq].prioridad > t->nodos[n->der].prioridad)) {
+            raiz = treapRotarDerecha(t, nodo);
+            t->nodos[raiz].der = treapEliminarEn(t, nodo, valor);
+        } else {
+            raiz = treapRotarIzquierda(t, nodo);
+            t->nodos[raiz].izq = treapEliminarEn(t, nodo, valor);
+        }
+        treapActualizar(t, raiz);
+        return raiz;
+    }
+    treapActualizar(t, nodo);
+    return nodo;
+}
+
+// Cuántos elementos son menores que valor (o menores o iguales si inclusivo)
+long long treapContarMenores(const Treap *t, int valor, bool inclusivo) {
+    long long cuenta = 0;
+    int nodo = t->raiz;
+    while (nodo >= 0) {
+        const NodoTreap *n = &t->nodos[nodo];
+        if (valor < n->valor || (valor == n->valor && !inclusivo)) {
+            nodo = n->izq;
+        } else {
+            cuenta += treapTam(t, n->izq) + n->repeticiones;
+            if (valor == n->valor) {
+                break;
+            }
+            nodo = n->der;
+        }
+    }
+    return cuenta;
+}
+
+/*
+CONTADOR DE INVERSIONES
+Envuelve a cualquiera de las dos estructuras y mantiene la ventana deslizante en un
+arreglo circular con los últimos w valores.
+*/
+typedef struct {
+    bool usaFenwick;
+    ArbolFenwick fenwick;
+    Treap treap;
+    long long presentes;     // Valores dentro de la estructura
+    long long inversiones;   // Inversiones entre los valores presentes
+    int *ventana;            // Arreglo circular con los valores presentes (NULL sin ventana)
+    long long tamVentana;
+    long long inicioVentana;
+} ContadorInversiones;
+
+// Cuántos valores presentes son menores (o menores o iguales) que valor
+long long contarMenoresPresentes(ContadorInversiones *c, int valor, bool inclusivo) {
+    if (c->usaFenwick) {
+        int pos = fenwickPosicion(&c->fenwick, valor);
+        return fenwickPrefijo(&c->fenwick, inclusivo ? pos : pos - 1);
+    }
+    return treapContarMenores(&c->treap, valor, inclusivo);
+}
+
+/*
+contadorInsertar - Agrega un valor al flujo y actualiza las inversiones
+Regresa false si el valor no pertenece al dominio o no hubo memoria
+*/
+bool contadorInsertar(ContadorInversiones *c, int valor) {
+    // Si la ventana está llena, primero sale el valor más antiguo
+    if (c->ventana != NULL && c->presentes == c->tamVentana) {
+        int antiguo = c->ventana[c->inicioVentana];
+        if (c->usaFenwick) {
+            fenwickSumar(&c->fenwick, fenwickPosicion(&c->fenwick, antiguo), -1);
+        } else {
+            c->treap.raiz = treapEliminarEn(&c->treap, c->treap.raiz, antiguo);
+        }
+        c->presentes--;
+        // Todos los presentes llegaron después; los menores formaban inversión con él
+        c->inversiones -= contarMenoresPresentes(c, antiguo, false);
+        c->inicioVentana = (c->inicioVentana + 1) % c->tamVentana;
+    }
+
+    // Los presentes mayores que valor llegaron antes: cada uno es una inversión nueva
+    if (c->usaFenwick) {
+        int pos = fenwickPosicion(&c->fenwick, valor);
+        if (pos == 0) {
+            return false;
+        }
+        c->inversiones += c->presentes - fenwickPrefijo(&c->fenwick, pos);
+        fenwickSumar(&c->fenwick, pos, 1);
+    } else {
+        c->inversiones += c->presentes - treapContarMenores(&c->treap, valor, true);
+        bool ok = true;
+        c->treap.raiz = treapInsertarEn(&c->treap, c->treap.raiz, valor, &ok);
+        if (!ok) {
+            return false;
+        }
+    }
+    if (c->ventana != NULL) {
+        c->ventana[(c->inicioVentana + c->presentes) % c->tamVentana] = valor;
+    }
+    c->presentes++;
+    return true;
+}
+
+/*
+leerDominio - Lee todos los enteros de un archivo en un arreglo que crece según haga falta
+*/
+int *leerDominio(const char *ruta, int *n) {
+    FuenteEnteros fuente;
+    if (!fuenteAbrir(&fuente, ruta)) {
+        return NULL;
+    }
+    int capacidad = 1 << 16, tam = 0;
+    int *valores = malloc(capacidad * sizeof(int));
+    while (valores != NULL) {
+        long long leidos = fuenteLeer(&fuente, valores + tam, capacidad - tam);
+        if (leidos == 0) {
+            break;
+        }
+        tam += (int)leidos;
+        if (tam == capacidad) {
+            capacidad *= 2;
+            int *nuevos = realloc(valores, capacidad * sizeof(int));
+            if (nuevos == NULL) {
+                free(valores);
+            }
+            valores = nuevos;
+        }
+    }
+    fuenteCerrar(&fuente);
+    *n = tam;
+    return valores;
+}
+
+/*
+valorDeToken - Convierte un token de la entrada en vivo ("-12", "+7", "300")
+Regresa false si tiene algo que no es dígito o no cabe en un int
+*/
+bool valorDeToken(const char *token, int *valor) {
+    bool negativo = *token == '-';
+    if (*token == '-' || *token == '+') {
+        token++;
+    }
+    if (*token == '\0') {
+        return false;
+    }
+    long long acumulado = 0;
+    for (; *token != '\0'; token++) {
+        if (!isdigit((unsigned char)*token)) {
+            return false;
+        }
+        acumulado = acumulado * 10 + (*token - '0');
+        if (acumulado > (long long)INT_MAX + 1) {
+            return false;
+        }
+    }
+    if (negativo) {
+        acumulado = -acumulado;
+    }
+    if (acumulado > INT_MAX) {
+        return false;
+    }
+    *valor = (int)acumulado;
+    return true;
+}
+
+/*
+procesarValor - Inserta un valor y reporta cada `cada` inserciones
+*/
+bool procesarValor(ContadorInversiones *c, int valor, long long *procesados, long long cada, bool enVivo) {
+    if (!contadorInsertar(c, valor)) {
+        printf("Error: el valor %d no esta en el dominio o no hubo memoria\n", valor);
+        return false;
+    }
+    (*procesados)++;
+    if (*procesados % cada == 0) {
+        printf("%lld %lld\n", *procesados, c->inversiones);
+        if (enVivo) {
+            fflush(stdout);
+        }
+    }
+    return true;
+}
+
+int main(int num_arg, char *arg_user[]) {
+    const char *rutaEntrada = NULL;
+    const char *rutaDominio = NULL;
+    long long tamVentana = 0;
+    long long cada = 1;
+    bool enVivo = false;
+    for (int i = 1; i < num_arg; i++) {
+        if (strcmp(arg_user[i], "--entrada") == 0 && i + 1 < num_arg) {
+            rutaEntrada = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--dominio") == 0 && i + 1 < num_arg) {
+            rutaDominio = arg_user[++i];
+        } else if (strcmp(arg_user[i], "--ventana") == 0 && i + 1 < num_arg) {
+            tamVentana = atoll(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--cada") == 0 && i + 1 < num_arg) {
+            cada = atoll(arg_user[++i]);
+        } else if (strcmp(arg_user[i], "--en-vivo") == 0) {
+            enVivo = true;
+        } else {
+            printf("\nUso: %s [--entrada archivo] [--dominio archivo] [--ventana w] [--cada k] [--en-vivo]\n", arg_user[0]);
+            exit(1);
+        }
+    }
+    if (cada < 1) {
+        cada = 1;
+    }
+
+    ContadorInversiones contador = {0};
+    if (rutaDominio != NULL) {
+        int tamDominio;
+        int *dominio = leerDominio(rutaDominio, &tamDominio);
+        if (dominio == NULL || tamDominio == 0 || !fenwickCrear(&contador.fenwick, dominio, tamDominio)) {
+            printf("Error: No se pudo cargar el dominio %s\n", rutaDominio);
+            exit(1);
+        }
+        contador.usaFenwick = true;
+    } else {
+        treapCrear(&contador.treap);
+    }
+    if (tamVentana > 0) {
+        contador.tamVentana = tamVentana;
+        contador.ventana = malloc(tamVentana * sizeof(int));
+        if (contador.ventana == NULL) {
+            printf("Error: No se pudo asignar memoria para la ventana\n");
+            exit(1);
+        }
+    }
+
+    long long procesados = 0;
+    bool ok = true;
+    if (enVivo) {
+        // Línea por línea: fread esperaría a llenar un bloque completo antes de reportar
+        FILE *archivo = rutaEntrada ? fopen(rutaEntrada, "r") : stdin;
+        if (archivo == NULL) {
+            printf("Error: No se pudo abrir %s\n", rutaEntrada);
+            exit(1);
+        }
+        // El token sigue abierto entre lecturas: un número cortado al final de linea se completa
+        // con la siguiente
+        char linea[4096];
+        char token[TAM_MAXIMO_TOKEN + 1];
+        int lonToken = 0;
+        bool fin = false;
+        while (ok && !fin) {
+            fin = fgets(linea, sizeof(linea), archivo) == NULL;
+            for (const char *p = fin ? "\n" : linea; ok && *p != '\0'; p++) {
+                if (!isspace((unsigned char)*p)) {
+                    // Los tokens más largos se truncan; igual no pueden ser un int válido
+                    if (lonToken < TAM_MAXIMO_TOKEN) {
+                        token[lonToken] = *p;
+                    }
+                    lonToken++;
+                    continue;
+                }
+                if (lonToken == 0) {
+                    continue;
+                }
+                token[lonToken < TAM_MAXIMO_TOKEN ? lonToken : TAM_MAXIMO_TOKEN] = '\0';
+                int valor;
+                if (lonToken <= TAM_MAXIMO_TOKEN && valorDeToken(token, &valor)) {
+                    ok = procesarValor(&contador, valor, &procesados, cada, true);
+                } else {
+                    fprintf(stderr, "Aviso: se ignora \"%s%s\" (no es un entero de 32 bits)\n", token,
+                            lonToken > TAM_MAXIMO_TOKEN ? "..." : "");
+                }
+                lonToken = 0;
+            }
+        }
+        if (archivo != stdin) {
+            fclose(archivo);
+        }
+    } else {
+        FuenteEnteros fuente;
+        if (!fuenteAbrir(&fuente, rutaEntrada)) {
+            printf("Error: No se pudo abrir %s\n", rutaEntrada);
+            exit(1);
+        }
+        int bloque[BLOQUE_FLUJO];
+        long long leidos;
+        while (ok && (leidos = fuenteLeer(&fuente, bloque, BLOQUE_FLUJO)) > 0) {
+            for (long long i = 0; ok && i < leidos; i++) {
+                ok = procesarValor(&contador, bloque[i], &procesados, cada, false);
+            }
+        }
+        fuenteCerrar(&fuente);
+    }
+
+    // Reporte final si el último no coincidió con un múltiplo de `cada`
+    if (ok && procesados % cada != 0) {
+        printf("%lld %lld\n", procesados, contador.inversiones);
+    }
+
+    if (contador.usaFenwick) {
+        fenwickLiberar(&contador.fenwick);
+    } else {
+        free(contador.treap.nodos);
+    }
+    free(contador.ventana);
+    return ok ? 0 : 1;
+}
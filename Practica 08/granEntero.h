@@ -0,0 +1,416 @@
+#ifndef GRAN_ENTERO_H
+#define GRAN_ENTERO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Enteros de precisión arbitraria con multiplicación de Karatsuba
+ *
+ * Un número es un arreglo de "limbs" de 64 bits en orden little-endian (limb 0 = dígito menos
+ * significativo en base 2^64) más un signo. Los productos de 64x64 bits se hacen con
+ * unsigned __int128 (GCC y Clang en 64 bits).
+ *
+ * La recursión de Karatsuba trabaja sobre la magnitud de operandos de igual longitud y usa la
+ * variante con resta: x*y = z2*B^(2m) + (z0 + z2 - (a0-a1)(b0-b1))*B^m + z0, donde las
+ * diferencias se guardan como |a0-a1| y |b0-b1| con su signo aparte. Toda la memoria
+ * temporal sale de un arreglo reservado una sola vez antes de la recursión.
+ */
+
+typedef uint64_t Limb;
+
+/**
+ * umbralKaratsuba - Limbs por debajo de los cuales se multiplica por el método escolar
+ *
+ * Con menos de ~30 limbs el costo de las sumas y restas extra de Karatsuba supera lo que
+ * ahorra la multiplicación que se evita.
+ */
+static size_t umbralKaratsuba = 32;
+
+/**
+ * limbsSignificativos - Longitud sin ceros a la izquierda
+ */
+static inline size_t limbsSignificativos(const Limb *a, size_t n) {
+    while (n > 0 && a[n - 1] == 0) {
+        n--;
+    }
+    return n;
+}
+
+/**
+ * compararLimbs - Compara dos magnitudes de la misma longitud
+ *
+ * Retorna: -1, 0 o 1 según a < b, a == b o a > b
+ */
+static inline int compararLimbs(const Limb *a, const Limb *b, size_t n) {
+    while (n-- > 0) {
+        if (a[n] != b[n]) {
+            return a[n] < b[n] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * sumarLimbs - r = a + b con na >= nb
+ *
+ * r tiene na limbs (puede ser el mismo arreglo que a). Retorna el acarreo final (0 o 1).
+ */
+static inline Limb sumarLimbs(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb) {
+    Limb acarreo = 0;
+    size_t i = 0;
+    for (; i < nb; i++) {
+        Limb s = a[i] + acarreo;
+        acarreo = s < acarreo;
+        r[i] = s + b[i];
+        acarreo += r[i] < s;
+    }
+    for (; i < na; i++) {
+        r[i] = a[i] + acarreo;
+        acarreo = r[i] < acarreo;
+    }
+    return acarreo;
+}
+
+/**
+ * restarLimbs - r = a - b con na >= nb
+ *
+ * r tiene na limbs (puede ser el mismo arreglo que a). Retorna el préstamo final (1 si b > a).
+ */
+static inline Limb restarLimbs(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb) {
+    Limb prestamo = 0;
+    size_t i = 0;
+    for (; i < nb; i++) {
+        Limb d = a[i] - b[i];
+        Limb p = a[i] < b[i];
+        r[i] = d - prestamo;
+        prestamo = p | (d < prestamo);
+    }
+    for (; i < na; i++) {
+        Limb ai = a[i];   // r puede ser a
+        r[i] = ai - prestamo;
+        prestamo = ai < prestamo;
+    }
+    return prestamo;
+}
+
+/**
+ * diferenciaAbsoluta - r = |a - b| para a de na limbs y b de nb <= na limbs
+ *
+ * r tiene na limbs. Retorna: 1 si a < b (la diferencia real es negativa), 0 si no
+ */
+static inline int diferenciaAbsoluta(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb) {
+    int negativo = limbsSignificativos(b, nb) > limbsSignificativos(a, na) ||
+                   (nb == na && compararLimbs(a, b, na) < 0);
+    if (!negativo && nb < na) {
+        // b tiene menos limbs: solo es mayor si la parte alta de a es cero y la baja es menor
+        negativo = limbsSignificativos(a + nb, na - nb) == 0 && compararLimbs(a, b, nb) < 0;
+    }
+    if (negativo) {
+        // b - a: a se trata como número de nb limbs porque su parte alta es cero
+        restarLimbs(r, b, nb, a, nb);
+        memset(r + nb, 0, (na - nb) * sizeof(Limb));
+    } else {
+        restarLimbs(r, a, na, b, nb);
+    }
+    return negativo;
+}
+
+/**
+ * multiplicacionEscolar - r = a * b por el método escolar, O(na * nb)
+ *
+ * r tiene na + nb limbs y no puede coincidir con a ni con b.
+ */
+static inline void multiplicacionEscolar(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb) {
+    memset(r, 0, (na + nb) * sizeof(Limb));
+    for (size_t i = 0; i < na; i++) {
+        unsigned __int128 acarreo = 0;
+        Limb ai = a[i];
+        if (ai == 0) {
+            continue;
+        }
+        for (size_t j = 0; j < nb; j++) {
+            acarreo += (unsigned __int128)ai * b[j] + r[i + j];
+            r[i + j] = (Limb)acarreo;
+            acarreo >>= 64;
+        }
+        r[i + nb] = (Limb)acarreo;
+    }
+}
+
+/**
+ * scratchKaratsuba - Limbs de memoria temporal que necesita karatsubaLimbs con n limbs
+ *
+ * Cada nivel usa 6m + 1 limbs (m = ceil(n/2)) y pasa el resto a la recursión sobre m limbs.
+ */
+static inline size_t scratchKaratsuba(size_t n) {
+    size_t total = 0;
+    while (n >= umbralKaratsuba && n > 1) {
+        size_t m = (n + 1) / 2;
+        total += 6 * m + 1;
+        n = m;
+    }
+    return total;
+}
+
+/**
+ * combinarKaratsuba - Último paso de Karatsuba sobre n limbs, con m = ceil(n/2) y h = n - m
+ * @r: 2n limbs con z0 en r[0..2m) y z2 en r[2m..2n)
+ * @z1: |a0-a1| * |b0-b1|, 2m limbs
+ * @medio: 2m + 1 limbs de trabajo
+ * @negativo: 1 si exactamente una de las diferencias era negativa
+ */
+static inline void combinarKaratsuba(Limb *r, const Limb *z1, Limb *medio, size_t n, int negativo) {
+    size_t m = (n + 1) / 2, h = n - m;
+    // medio = z0 + z2 (z2 tiene 2h <= 2m limbs)
+    medio[2 * m] = sumarLimbs(medio, r, 2 * m, r + 2 * m, 2 * h);
+    // (a0-a1)(b0-b1) es positivo si ambas diferencias tienen el mismo signo
+    if (negativo) {
+        sumarLimbs(medio, medio, 2 * m + 1, z1, 2 * m);
+    } else {
+        restarLimbs(medio, medio, 2 * m + 1, z1, 2 * m);
+    }
+    // r += medio * B^m; el resultado cabe en 2n limbs, así que el acarreo final se pierde en 0
+    size_t largo = 2 * n - m;
+    sumarLimbs(r + m, r + m, largo, medio, largo < 2 * m + 1 ? largo : 2 * m + 1);
+}
+
+/**
+ * karatsubaLimbs - r = a * b para dos magnitudes de n limbs
+ * @r: resultado de 2n limbs (distinto de a y b)
+ * @scratch: al menos scratchKaratsuba(n) limbs
+ *
+ * Con m = ceil(n/2), a = a1*B^m + a0 y b = b1*B^m + b0 (a1 y b1 tienen h = n - m limbs):
+ * 1. z0 = a0*b0 va directo a r[0..2m) y z2 = a1*b1 a r[2m..2n)
+ * 2. z1 = |a0-a1| * |b0-b1|, con signo negativo si exactamente una diferencia lo es
+ * 3. medio = z0 + z2 - signo*z1 (siempre >= 0: es a0*b1 + a1*b0) se suma en r desde B^m
+ */
+static void karatsubaLimbs(Limb *r, const Limb *a, const Limb *b, size_t n, Limb *scratch) {
+    if (n < umbralKaratsuba || n == 1) {
+        multiplicacionEscolar(r, a, n, b, n);
+        return;
+    }
+    size_t m = (n + 1) / 2, h = n - m;
+    Limb *da = scratch;              // |a0 - a1|, m limbs
+    Limb *db = da + m;               // |b0 - b1|, m limbs
+    Limb *z1 = db + m;               // 2m limbs
+    Limb *medio = z1 + 2 * m;        // 2m + 1 limbs
+    Limb *resto = medio + 2 * m + 1;
+
+    int negativo = diferenciaAbsoluta(da, a, m, a + m, h);
+    negativo ^= diferenciaAbsoluta(db, b, m, b + m, h);
+
+    karatsubaLimbs(r, a, b, m, resto);
+    karatsubaLimbs(r + 2 * m, a + m, b + m, h, resto);
+    karatsubaLimbs(z1, da, db, m, resto);
+    combinarKaratsuba(r, z1, medio, n, negativo);
+}
+
+/**
+ * scratchMultiplicacion - Limbs temporales para multiplicarLimbs con operandos de na y nb limbs
+ */
+static inline size_t scratchMultiplicacion(size_t na, size_t nb) {
+    size_t corto = na < nb ? na : nb;
+    // Producto de un trozo (2*corto), el último trozo rellenado con ceros (corto) y la recursión
+    return 3 * corto + scratchKaratsuba(corto);
+}
+
+/**
+ * multiplicarLimbs - r = a * b para magnitudes de cualquier longitud
+ * @r: na + nb limbs, distinto de a y b
+ * @scratch: al menos scratchMultiplicacion(na, nb) limbs
+ *
+ * Si las longitudes difieren, el operando largo se corta en trozos del tamaño del corto; cada
+ * trozo se multiplica con Karatsuba y se acumula en su posición. El último trozo, si es más
+ * corto, se rellena con ceros.
+ */
+static inline void multiplicarLimbs(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb, Limb *scratch) {
+    if (na < nb) {
+        const Limb *t = a;
+        a = b;
+        b = t;
+        size_t tn = na;
+        na = nb;
+        nb = tn;
+    }
+    if (nb == 0) {
+        memset(r, 0, na * sizeof(Limb));
+        return;
+    }
+    if (nb < umbralKaratsuba) {
+        multiplicacionEscolar(r, a, na, b, nb);
+        return;
+    }
+    if (na == nb) {
+        karatsubaLimbs(r, a, b, nb, scratch);
+        return;
+    }
+    Limb *trozo = scratch;
+    Limb *relleno = trozo + 2 * nb;
+    Limb *resto = relleno + nb;
+    memset(r, 0, (na + nb) * sizeof(Limb));
+    for (size_t i = 0; i < na; i += nb) {
+        size_t lon = na - i < nb ? na - i : nb;
+        if (lon == nb) {
+            karatsubaLimbs(trozo, a + i, b, nb, resto);
+        } else {
+            memcpy(relleno, a + i, lon * sizeof(Limb));
+            memset(relleno + lon, 0, (nb - lon) * sizeof(Limb));
+            karatsubaLimbs(trozo, relleno, b, nb, resto);
+        }
+        // r[i..] += trozo; r[i + lon + nb..] es cero todavía, así que el acarreo no se sale de r
+        Limb acarreo = sumarLimbs(r + i, r + i, lon + nb, trozo, lon + nb);
+        for (size_t j = i + lon + nb; acarreo && j < na + nb; j++) {
+            r[j] += acarreo;
+            acarreo = r[j] == 0;
+        }
+    }
+}
+
+/**
+ * GranEntero - Entero con signo de precisión arbitraria
+ */
+typedef struct {
+    Limb *limbs;
+    size_t n;       // Limbs significativos (0 representa el cero)
+    int negativo;
+} GranEntero;
+
+static inline int granReservar(GranEntero *x, size_t n) {
+    x->limbs = calloc(n > 0 ? n : 1, sizeof(Limb));
+    x->n = 0;
+    x->negativo = 0;
+    return x->limbs != NULL;
+}
+
+static inline void granLiberar(GranEntero *x) {
+    free(x->limbs);
+    x->limbs = NULL;
+    x->n = 0;
+}
+
+/**
+ * granMultiplicar - r = x * y
+ *
+ * Reserva el resultado y la memoria temporal (una sola vez) y la libera al terminar.
+ * Retorna: 1 si todo salió bien, 0 si faltó memoria
+ */
+static inline int granMultiplicar(GranEntero *r, const GranEntero *x, const GranEntero *y) {
+    if (!granReservar(r, x->n + y->n)) {
+        return 0;
+    }
+    if (x->n == 0 || y->n == 0) {
+        return 1;
+    }
+    Limb *scratch = malloc((scratchMultiplicacion(x->n, y->n) + 1) * sizeof(Limb));
+    if (scratch == NULL) {
+        granLiberar(r);
+        return 0;
+    }
+    multiplicarLimbs(r->limbs, x->limbs, x->n, y->limbs, y->n, scratch);
+    free(scratch);
+    r->n = limbsSignificativos(r->limbs, x->n + y->n);
+    r->negativo = r->n > 0 && (x->negativo != y->negativo);
+    return 1;
+}
+
+// 10^19: la mayor potencia de 10 que cabe en un limb
+#define BASE_DECIMAL_LIMB 10000000000000000000ull
+
+/**
+ * granDesdeTexto - Convierte una cadena decimal (con '-' opcional) a GranEntero
+ *
+ * Procesa grupos de 19 dígitos multiplicando el acumulado por 10^19: O(d²) para d dígitos,
+ * suficiente para capturar operandos; los de millones de dígitos se generan directamente en limbs.
+ * Retorna: 1 si la cadena era válida y hubo memoria, 0 si no
+ */
+static inline int granDesdeTexto(GranEntero *x, const char *texto) {
+    int negativo = (*texto == '-');
+    texto += negativo;
+    size_t digitos = strlen(texto);
+    if (digitos == 0 || !granReservar(x, digitos / 19 + 2)) {
+        return 0;
+    }
+    size_t i = 0;
+    while (i < digitos) {
+        size_t grupo = (digitos - i) % 19 == 0 ? 19 : (digitos - i) % 19;
+        Limb valor = 0, escala = 1;
+        for (size_t k = 0; k < grupo; k++, i++) {
+            if (texto[i] < '0' || texto[i] > '9') {
+                granLiberar(x);
+                return 0;
+            }
+            valor = valor * 10 + (Limb)(texto[i] - '0');
+            escala *= 10;
+        }
+        // x = x * escala + valor
+        unsigned __int128 acarreo = valor;
+        for (size_t k = 0; k < x->n; k++) {
+            acarreo += (unsigned __int128)x->limbs[k] * escala;
+            x->limbs[k] = (Limb)acarreo;
+            acarreo >>= 64;
+        }
+        if (acarreo != 0) {
+            x->limbs[x->n++] = (Limb)acarreo;
+        }
+    }
+    x->n = limbsSignificativos(x->limbs, x->n);
+    x->negativo = negativo && x->n > 0;
+    return 1;
+}
+
+/**
+ * granImprimir - Escribe x en decimal en el archivo dado
+ *
+ * Divide repetidamente entre 10^19 (O(d²)). Retorna: 1 si hubo memoria, 0 si no
+ */
+static inline int granImprimir(FILE *salida, const GranEntero *x) {
+    if (x->n == 0) {
+        fputs("0", salida);
+        return 1;
+    }
+    Limb *copia = malloc(x->n * sizeof(Limb));
+    Limb *grupos = malloc((x->n * 20 / 19 + 2) * sizeof(Limb));
+    if (copia == NULL || grupos == NULL) {
+        free(copia);
+        free(grupos);
+        return 0;
+    }
+    memcpy(copia, x->limbs, x->n * sizeof(Limb));
+    size_t n = x->n, g = 0;
+    while (n > 0) {
+        unsigned __int128 resto = 0;
+        for (size_t k = n; k-- > 0;) {
+            resto = (resto << 64) | copia[k];
+            copia[k] = (Limb)(resto / BASE_DECIMAL_LIMB);
+            resto %= BASE_DECIMAL_LIMB;
+        }
+        grupos[g++] = (Limb)resto;
+        n = limbsSignificativos(copia, n);
+    }
+    fprintf(salida, "%s%llu", x->negativo ? "-" : "", (unsigned long long)grupos[g - 1]);
+    while (g-- > 1) {
+        fprintf(salida, "%019llu", (unsigned long long)grupos[g - 1]);
+    }
+    free(copia);
+    free(grupos);
+    return 1;
+}
+
+/**
+ * residuoLimbs - a mod p para un módulo p < 2^63
+ *
+ * Sirve para verificar productos enormes sin una segunda multiplicación: (a mod p)(b mod p)
+ * debe coincidir con (a*b) mod p.
+ */
+static inline Limb residuoLimbs(const Limb *a, size_t n, Limb p) {
+    unsigned __int128 resto = 0;
+    for (size_t k = n; k-- > 0;) {
+        resto = ((resto << 64) | a[k]) % p;
+    }
+    return (Limb)resto;
+}
+
+#endif
@@ -2,6 +2,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <stdint.h>
+#include "granEntero.h"
+#include "multiplicacionRapida.h"
+#include "karatsubaParalelo.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
 
 /*
  * Algoritmo de Multiplicación de Karatsuba
@@ -13,21 +19,26 @@
  * en lugar de 4, mediante la identidad: bc + ad = ac + bd - (a-b)(c-d)
 */
 
-
-/**
- * potencia - Calcula 2^exp
- * @exp: exponente
- * 
- * Retorna: 2 elevado a la potencia exp
- * Uso: Calcular desplazamientos binarios (2^m, 2^(2m))
+/*
+ * Compilación: gcc karatsubaMultiply.c -o karatsuba -pthread
+ * Ejecución:   ./karatsuba                      Ejemplos con long long y con enteros grandes
+ *              ./karatsuba {x} {y}              Producto exacto de dos enteros decimales de cualquier tamaño
+ *              ./karatsuba --digitos {d} [--umbral u] [--semilla s]
+ *                  Multiplica dos números al azar de d dígitos decimales con cada nivel (escolar,
+ *                  Karatsuba, Toom-3, NTT y la selección automática), mide el tiempo y verifica
+ *                  el producto
+ *              ./karatsuba --digitos {d} --escalamiento [--hilos h]
+ *                  Karatsuba paralelo con 1, 2, 4, ... hasta h hilos (por defecto, los núcleos de la
+ *                  máquina): tiempo y aceleración respecto a un hilo
+ *              ./karatsuba --calibrar [archivo]
+ *                  Mide en esta máquina los cruces escolar/Karatsuba/Toom-3/NTT y los guarda
+ *                  (por defecto en umbrales.txt)
+ *
+ * Si existe umbrales.txt en el directorio actual se carga al iniciar; --umbrales {archivo} carga otro.
  */
-long long potencia(int exp) {
-    long long resultado = 1;
-    for (int i = 0; i < exp; i++) {
-        resultado *= 2;
-    }
-    return resultado;
-}
+
+#define ARCHIVO_UMBRALES "umbrales.txt"
+
 
 /**
  * karatsubaMultiply - Multiplicación usando algoritmo de Karatsuba
@@ -41,44 +52,49 @@ long long potencia(int exp) {
  * 3. Calcular 3 productos: ac, bd, (a-b)(c-d)
  * 4. Aplicar fórmula: x*y = 2^(2m)*ac + 2^m*(ac+bd-(a-b)(c-d)) + bd
  * 
+ * Las mitades se obtienen con desplazamientos y máscaras sobre la magnitud; el signo del
+ * producto se calcula aparte, así (a-b) y (c-d) pueden ser negativos sin problema.
+ * El resultado debe caber en long long (operandos de hasta 31 bits); para números más
+ * grandes está multiplicarLimbs en granEntero.h.
+ * 
  * Retorna: producto x * y
  * Complejidad: O(n^1.585) vs O(n²) de multiplicación tradicional
  */
 long long karatsubaMultiply(long long x, long long y, int n) {
+    // El signo se resuelve una vez y la recursión sigue con magnitudes
+    int negativo = (x < 0) != (y < 0);
+    unsigned long long ux = x < 0 ? 0ull - (unsigned long long)x : (unsigned long long)x;
+    unsigned long long uy = y < 0 ? 0ull - (unsigned long long)y : (unsigned long long)y;
+
     // Caso base: números de un bit, multiplicación directa
     if (n == 1) {
-        return x * y;
+        long long producto = (long long)(ux * uy);
+        return negativo ? -producto : producto;
     }
     
     // Calcular mitad del número de bits
     int m = n / 2;
-    long long dosElevadoM = potencia(m);
+    unsigned long long mascara = (1ull << m) - 1;
     
     // Dividir x en: a (bits altos) y b (bits bajos)
     // Dividir y en: c (bits altos) y d (bits bajos)
     // Ejemplo: x=10001101, m=4 → a=1000, b=1101
-    long long a = x / dosElevadoM;
-    long long b = x % dosElevadoM;
-    long long c = y / dosElevadoM;
-    long long d = y % dosElevadoM;
+    long long a = (long long)(ux >> m);
+    long long b = (long long)(ux & mascara);
+    long long c = (long long)(uy >> m);
+    long long d = (long long)(uy & mascara);
     
     // Tres multiplicaciones recursivas (truco de Karatsuba)
     long long e = karatsubaMultiply(a, c, m);      // e = ac
     long long f = karatsubaMultiply(b, d, m);      // f = bd
-    long long g = karatsubaMultiply(a - b, c - d, m);  // g = (a-b)(c-d)
+    long long g = karatsubaMultiply(a - b, c - d, m);  // g = (a-b)(c-d), puede ser negativo
     
     // Aplicar fórmula de Karatsuba:
     // x*y = 2^(2m)*ac + 2^m*(bc+ad) + bd
     // Donde: bc+ad = ac + bd - (a-b)(c-d) = e + f - g
-    long long dosElevado2M = potencia(2 * m);
-    long long resultado = dosElevado2M * e + dosElevadoM * (e + f - g) + f;
+    long long resultado = (e << (2 * m)) + ((e + f - g) << m) + f;
     
-    // Corrección para casos con números negativos
-    if (g < 0) {
-        resultado = dosElevado2M * e + dosElevadoM * (e + f + (-g)) + f;
-    }
-    
-    return resultado;
+    return negativo ? -resultado : resultado;
 }
 
 /**
@@ -107,13 +123,363 @@ int contarBits(long long num) {
     return potenciaDeDos;
 }
 
+// Módulo para verificar productos: primo de Mersenne 2^61 - 1
+#define MODULO_VERIFICACION ((1ull << 61) - 1)
+
+/**
+ * verificarProducto - Comprueba r = x * y módulo 2^61 - 1
+ *
+ * Retorna: 1 si los residuos coinciden (un producto incorrecto pasa con probabilidad ~2^-61)
+ */
+int verificarProducto(const Limb *r, size_t nr, const Limb *x, size_t nx, const Limb *y, size_t ny) {
+    unsigned __int128 esperado = (unsigned __int128)residuoLimbs(x, nx, MODULO_VERIFICACION) *
+                                 residuoLimbs(y, ny, MODULO_VERIFICACION);
+    return (Limb)(esperado % MODULO_VERIFICACION) == residuoLimbs(r, nr, MODULO_VERIFICACION);
+}
+
+// Niveles que se pueden forzar en las mediciones
+typedef enum { NIVEL_AUTOMATICO, NIVEL_ESCOLAR, NIVEL_KARATSUBA, NIVEL_TOOM3, NIVEL_NTT } NivelMultiplicacion;
+
+static const char *NOMBRES_NIVEL[] = {"Automatico", "Escolar", "Karatsuba", "Toom-3", "NTT"};
+
+/**
+ * multiplicarConNivel - r = x * y (ambos de n limbs) usando solo el nivel indicado
+ *
+ * Ajusta los umbrales para forzar el nivel, reserva la memoria temporal y los restaura al final.
+ * Retorna: 1 si se calculó el producto, 0 si faltó memoria
+ */
+int multiplicarConNivel(NivelMultiplicacion nivel, Limb *r, const Limb *x, const Limb *y, size_t n) {
+    UmbralesMultiplicacion guardados = umbrales;
+    if (nivel == NIVEL_ESCOLAR) {
+        multiplicacionEscolar(r, x, n, y, n);
+        return 1;
+    }
+    if (nivel == NIVEL_NTT) {
+        return multiplicarNTT(r, x, n, y, n);
+    }
+    if (nivel == NIVEL_KARATSUBA) {
+        umbrales.toom3 = SIZE_MAX;
+        umbrales.ntt = SIZE_MAX;
+    } else if (nivel == NIVEL_TOOM3) {
+        umbrales.toom3 = umbralKaratsuba;
+        umbrales.ntt = SIZE_MAX;
+    }
+    Limb *scratch = malloc((scratchRapido(n, n) + 1) * sizeof(Limb));
+    if (scratch != NULL) {
+        multiplicarRapido(r, x, n, y, n, scratch);
+        free(scratch);
+    }
+    umbrales = guardados;
+    return scratch != NULL;
+}
+
+/**
+ * tiempoProducto - Segundos por producto de n limbs con el nivel dado
+ *
+ * Repite el producto hasta acumular al menos 50 ms para que los tamaños chicos se midan bien.
+ */
+double tiempoProducto(NivelMultiplicacion nivel, Limb *r, const Limb *x, const Limb *y, size_t n) {
+    int repeticiones = 0;
+    double inicio = tiempoMonotonico(), transcurrido;
+    do {
+        multiplicarConNivel(nivel, r, x, y, n);
+        repeticiones++;
+        transcurrido = tiempoMonotonico() - inicio;
+    } while (transcurrido < 0.05);
+    return transcurrido / repeticiones;
+}
+
+/**
+ * llenarAleatorio - Llena n limbs con bits al azar
+ */
+void llenarAleatorio(Limb *x, size_t n, GeneradorAleatorio *g) {
+    for (size_t i = 0; i < n; i++) {
+        x[i] = generadorSiguiente(g);
+    }
+}
+
+/**
+ * benchmarkGrandes - Multiplica dos números al azar de d dígitos decimales con cada nivel
+ * @digitos: dígitos decimales de cada operando (~3.32 bits por dígito)
+ * @semilla: semilla del generador
+ *
+ * El escolar solo se mide hasta ~200 000 dígitos y Karatsuba y Toom-3 hasta ~20 millones;
+ * cada resultado se compara con el automático y se verifica módulo 2^61 - 1.
+ */
+int benchmarkGrandes(long long digitos, unsigned long long semilla) {
+    size_t n = (size_t)(digitos * 3.3219280948873623 / 64) + 1;
+    Limb *x = malloc(n * sizeof(Limb));
+    Limb *y = malloc(n * sizeof(Limb));
+    Limb *automatico = malloc(2 * n * sizeof(Limb));
+    Limb *r = malloc(2 * n * sizeof(Limb));
+    int estado = 1;
+    if (x == NULL || y == NULL || automatico == NULL || r == NULL) {
+        printf("Error: No se pudo asignar memoria\n");
+        goto liberar;
+    }
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    llenarAleatorio(x, n, &g);
+    llenarAleatorio(y, n, &g);
+
+    printf("Operandos de %lld digitos (%zu limbs de 64 bits)\n", digitos, n);
+    printf("Umbrales: karatsuba %zu, toom3 %zu, ntt %zu limbs\n", umbralKaratsuba, umbrales.toom3, umbrales.ntt);
+    double t = tiempoMonotonico();
+    if (!multiplicarConNivel(NIVEL_AUTOMATICO, automatico, x, y, n)) {
+        printf("Error: No se pudo asignar memoria\n");
+        goto liberar;
+    }
+    double tAutomatico = tiempoMonotonico() - t;
+    printf("%-10s %f s (%s)\n", NOMBRES_NIVEL[NIVEL_AUTOMATICO], tAutomatico,
+           verificarProducto(automatico, 2 * n, x, n, y, n) ? "verificado mod 2^61-1" : "PRODUCTO INCORRECTO");
+
+    for (NivelMultiplicacion nivel = NIVEL_ESCOLAR; nivel <= NIVEL_NTT; nivel++) {
+        if ((nivel == NIVEL_ESCOLAR && n > 10000) || ((nivel == NIVEL_KARATSUBA || nivel == NIVEL_TOOM3) && n > 1000000) ||
+            (nivel == NIVEL_NTT && !nttAplica(n, n))) {
+            continue;
+        }
+        t = tiempoMonotonico();
+        int ok = multiplicarConNivel(nivel, r, x, y, n);
+        t = tiempoMonotonico() - t;
+        printf("%-10s %f s (%.2fx del automatico) %s\n", NOMBRES_NIVEL[nivel], t, t / tAutomatico,
+               !ok ? "SIN MEMORIA" : memcmp(r, automatico, 2 * n * sizeof(Limb)) == 0 ? "" : "RESULTADO DISTINTO");
+    }
+    estado = 0;
+
+liberar:
+    free(x);
+    free(y);
+    free(automatico);
+    free(r);
+    return estado;
+}
+
+/**
+ * benchmarkEscalamiento - Aceleración de Karatsuba paralelo según el número de hilos
+ * @digitos: dígitos decimales de cada operando
+ * @maxHilos: se prueba con 1, 2, 4, ... y con maxHilos
+ *
+ * Cada producto se compara con el de un hilo.
+ */
+int benchmarkEscalamiento(long long digitos, int maxHilos, unsigned long long semilla) {
+    size_t n = (size_t)(digitos * 3.3219280948873623 / 64) + 1;
+    Limb *x = malloc(n * sizeof(Limb));
+    Limb *y = malloc(n * sizeof(Limb));
+    Limb *referencia = malloc(2 * n * sizeof(Limb));
+    Limb *r = malloc(2 * n * sizeof(Limb));
+    int estado = 1;
+    if (x == NULL || y == NULL || referencia == NULL || r == NULL) {
+        printf("Error: No se pudo asignar memoria\n");
+        goto liberar;
+    }
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    llenarAleatorio(x, n, &g);
+    llenarAleatorio(y, n, &g);
+
+    printf("Operandos de %lld digitos (%zu limbs), hasta %d hilos\n", digitos, n, maxHilos);
+    printf("Todas las corridas, incluida la de un hilo, usan Karatsuba/Toom-3 sin NTT\n");
+    printf("%6s %6s %12s %10s\n", "hilos", "nivel", "segundos", "aceleracion");
+    double tUnHilo = 0;
+    for (int hilos = 1; hilos <= maxHilos; hilos = hilos * 2 > maxHilos && hilos < maxHilos ? maxHilos : hilos * 2) {
+        Limb *destino = hilos == 1 ? referencia : r;
+        double t = tiempoMonotonico();
+        int ok = multiplicarParalelo(destino, x, n, y, n, hilos);
+        t = tiempoMonotonico() - t;
+        if (!ok) {
+            printf("Error: No se pudo asignar memoria\n");
+            goto liberar;
+        }
+        if (hilos == 1) {
+            tUnHilo = t;
+        }
+        printf("%6d %6d %12.6f %9.2fx %s\n", hilos, profundidadKaratsuba(hilos), t, tUnHilo / t,
+               hilos == 1 || memcmp(r, referencia, 2 * n * sizeof(Limb)) == 0 ? "" : "RESULTADO DISTINTO");
+        fflush(stdout);
+        if (hilos == maxHilos) {
+            break;
+        }
+    }
+    printf("%s\n", verificarProducto(referencia, 2 * n, x, n, y, n) ? "Producto verificado mod 2^61-1"
+                                                                      : "PRODUCTO INCORRECTO");
+    estado = 0;
+
+liberar:
+    free(x);
+    free(y);
+    free(referencia);
+    free(r);
+    return estado;
+}
+
+/**
+ * buscarCruce - Primer tamaño de la lista donde el nivel alto le gana al bajo dos veces seguidas
+ *
+ * Imprime los tiempos de ambos niveles para cada tamaño. Retorna el tamaño del cruce o 0 si el
+ * nivel alto no ganó.
+ */
+size_t buscarCruce(NivelMultiplicacion bajo, NivelMultiplicacion alto, const size_t *tamanios, int cantidad,
+                   Limb *r, const Limb *x, const Limb *y) {
+    int ganadas = 0;
+    for (int i = 0; i < cantidad; i++) {
+        size_t n = tamanios[i];
+        double tBajo = tiempoProducto(bajo, r, x, y, n);
+        // Toom-3 se mide en un solo nivel (toom3 = n); debajo sigue Karatsuba
+        UmbralesMultiplicacion guardados = umbrales;
+        if (alto == NIVEL_TOOM3) {
+            umbrales.toom3 = n;
+        }
+        double tAlto = tiempoProducto(alto == NIVEL_TOOM3 ? NIVEL_AUTOMATICO : alto, r, x, y, n);
+        umbrales = guardados;
+        printf("  %6zu limbs  %-10s %10.6f ms  %-10s %10.6f ms\n", n, NOMBRES_NIVEL[bajo], tBajo * 1e3,
+               NOMBRES_NIVEL[alto], tAlto * 1e3);
+        fflush(stdout);
+        ganadas = tAlto < tBajo ? ganadas + 1 : 0;
+        if (ganadas == 2) {
+            return tamanios[i - 1];
+        }
+    }
+    return 0;
+}
+
+/**
+ * calibrarUmbrales - Mide los cruces entre niveles en esta máquina y los guarda en ruta
+ *
+ * 1. Umbral escolar/Karatsuba: el que da el menor tiempo de Karatsuba con 768 limbs
+ * 2. Karatsuba/Toom-3: primer tamaño donde un nivel de Toom-3 sobre Karatsuba gana
+ * 3. Toom-3/NTT: primer tamaño donde la NTT le gana a la selección sin NTT
+ */
+int calibrarUmbrales(const char *ruta) {
+    const size_t maximo = 32768;
+    Limb *x = malloc(maximo * sizeof(Limb));
+    Limb *y = malloc(maximo * sizeof(Limb));
+    Limb *r = malloc(2 * maximo * sizeof(Limb));
+    if (x == NULL || y == NULL || r == NULL) {
+        printf("Error: No se pudo asignar memoria\n");
+        return 1;
+    }
+    GeneradorAleatorio g;
+    generadorSembrar(&g, 1);
+    llenarAleatorio(x, maximo, &g);
+    llenarAleatorio(y, maximo, &g);
+
+    static const size_t candidatosKaratsuba[] = {8, 12, 16, 20, 24, 32, 40, 48, 64, 96};
+    printf("Umbral escolar/Karatsuba (Karatsuba con 768 limbs):\n");
+    size_t mejor = umbralKaratsuba;
+    double tMejor = 0;
+    for (size_t i = 0; i < sizeof(candidatosKaratsuba) / sizeof(candidatosKaratsuba[0]); i++) {
+        umbralKaratsuba = candidatosKaratsuba[i];
+        double t = tiempoProducto(NIVEL_KARATSUBA, r, x, y, 768);
+        printf("  umbral %3zu  %10.6f ms\n", umbralKaratsuba, t * 1e3);
+        if (i == 0 || t < tMejor) {
+            mejor = umbralKaratsuba;
+            tMejor = t;
+        }
+    }
+    umbralKaratsuba = mejor;
+
+    static const size_t tamaniosToom[] = {48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096};
+    printf("Cruce Karatsuba/Toom-3:\n");
+    size_t cruce = buscarCruce(NIVEL_KARATSUBA, NIVEL_TOOM3, tamaniosToom,
+                               (int)(sizeof(tamaniosToom) / sizeof(tamaniosToom[0])), r, x, y);
+    umbrales.toom3 = cruce != 0 ? cruce : SIZE_MAX;
+
+    static const size_t tamaniosNTT[] = {128, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192,
+                                         12288, 16384, 24576, 32768};
+    printf("Cruce Toom-3/NTT:\n");
+    umbrales.ntt = SIZE_MAX;
+    cruce = buscarCruce(NIVEL_AUTOMATICO, NIVEL_NTT, tamaniosNTT, (int)(sizeof(tamaniosNTT) / sizeof(tamaniosNTT[0])),
+                        r, x, y);
+    umbrales.ntt = cruce != 0 ? cruce : SIZE_MAX;
+
+    printf("Umbrales: karatsuba %zu, toom3 %zu, ntt %zu limbs\n", umbralKaratsuba, umbrales.toom3, umbrales.ntt);
+    int ok = guardarUmbrales(ruta);
+    printf(ok ? "Guardados en %s\n" : "Error: No se pudo escribir %s\n", ruta);
+    free(x);
+    free(y);
+    free(r);
+    return ok ? 0 : 1;
+}
+
+/**
+ * multiplicarTextos - Imprime el producto exacto de dos enteros decimales
+ */
+int multiplicarTextos(const char *textoX, const char *textoY) {
+    GranEntero x = {0}, y = {0}, r = {0};
+    int estado = 1;
+    if (!granDesdeTexto(&x, textoX) || !granDesdeTexto(&y, textoY)) {
+        printf("Error: se esperaban dos enteros decimales\n");
+        goto liberar;
+    }
+    if (!granMultiplicarRapido(&r, &x, &y)) {
+        printf("Error: No se pudo asignar memoria\n");
+        goto liberar;
+    }
+    granImprimir(stdout, &r);
+    printf("\n");
+    estado = 0;
+liberar:
+    granLiberar(&x);
+    granLiberar(&y);
+    granLiberar(&r);
+    return estado;
+}
+
 /**
  * main - Función principal con ejemplos de uso
  * 
  * Ejecuta tres ejemplos del algoritmo de Karatsuba con diferentes
  * tamaños de números y verifica resultados contra multiplicación normal.
  */
-int main() {
+int main(int argc, char *argv[]) {
+    cargarUmbrales(ARCHIVO_UMBRALES);
+    if (argc > 1) {
+        long long digitos = -1;
+        unsigned long long semilla = 1;
+        const char *rutaCalibracion = NULL;
+        int escalamiento = 0, hilos = numeroNucleos();
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--calibrar") == 0) {
+                rutaCalibracion = i + 1 < argc && argv[i + 1][0] != '-' ? argv[++i] : ARCHIVO_UMBRALES;
+            } else if (strcmp(argv[i], "--umbrales") == 0 && i + 1 < argc) {
+                if (!cargarUmbrales(argv[++i])) {
+                    printf("Error: No se pudo leer %s\n", argv[i]);
+                    return 1;
+                }
+            } else if (strcmp(argv[i], "--escalamiento") == 0) {
+                escalamiento = 1;
+            } else if (strcmp(argv[i], "--hilos") == 0 && i + 1 < argc) {
+                hilos = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--digitos") == 0 && i + 1 < argc) {
+                digitos = atoll(argv[++i]);
+            } else if (strcmp(argv[i], "--umbral") == 0 && i + 1 < argc) {
+                umbralKaratsuba = (size_t)atoll(argv[++i]);
+            } else if (strcmp(argv[i], "--semilla") == 0 && i + 1 < argc) {
+                semilla = strtoull(argv[++i], NULL, 10);
+            } else if (argc == 3 && i == 1) {
+                return multiplicarTextos(argv[1], argv[2]);
+            } else {
+                printf("Opcion no reconocida: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        if (rutaCalibracion != NULL) {
+            return calibrarUmbrales(rutaCalibracion);
+        }
+        if (digitos <= 0 || umbralKaratsuba < 2) {
+            printf("Error: se necesita --digitos d con d > 0 y un umbral de al menos 2 limbs\n");
+            return 1;
+        }
+        if (escalamiento) {
+            if (hilos < 1) {
+                printf("Error: --hilos debe ser positivo\n");
+                return 1;
+            }
+            return benchmarkEscalamiento(digitos, hilos, semilla);
+        }
+        return benchmarkGrandes(digitos, semilla);
+    }
+
     // Ejemplo 1: números de 8 bits
     long long x1 = 137;  // Binario: 10001001
     long long y1 = 225;  // Binario: 11100001
@@ -169,7 +535,16 @@ int main() {
     
     long long resultado3 = karatsubaMultiply(x3, y3, bits3);
     printf("Resultado con Karatsuba: %lld\n", resultado3);
-    printf("Verificacion (multiplicacion normal): %lld\n", x3 * y3);
+    printf("Verificacion (multiplicacion normal): %lld\n\n", x3 * y3);
+    
+    // Ejemplo 4: operandos que ya no caben en long long (el producto tiene 76 dígitos)
+    printf("=== Ejemplo 4 (enteros grandes) ===\n");
+    const char *x4 = "3141592653589793238462643383279502884197";
+    const char *y4 = "-2718281828459045235360287471352662497757";
+    printf("x = %s\n", x4);
+    printf("y = %s\n", y4);
+    printf("Resultado con Karatsuba: ");
+    multiplicarTextos(x4, y4);
     
     return 0;
 }
\ No newline at end of file
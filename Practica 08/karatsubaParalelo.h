@@ -0,0 +1,186 @@
+#ifndef KARATSUBA_PARALELO_H
+#define KARATSUBA_PARALELO_H
+
+#include "multiplicacionRapida.h"
+#include "../Comun/hilos.h"
+
+/*
+ * Karatsuba paralelo
+ *
+ * Los tres productos de cada nivel (z0 = a0*b0, z2 = a1*b1 y z1 = |a0-a1|*|b0-b1|) no dependen
+ * entre sí. En los primeros `profundidad` niveles z0 y z2 se calculan en hilos nuevos mientras el
+ * hilo actual calcula z1; debajo de eso, o con operandos de menos de GRANO_KARATSUBA_PARALELO
+ * limbs, cada tarea sigue sola con multiplicarBalanceado (Karatsuba o Toom-3 según tamaño).
+ *
+ * Cada tarea recibe su propio pedazo de la memoria temporal, reservada completa antes de empezar:
+ * los hilos nunca comparten ni piden memoria durante la recursión. Por eso multiplicarParalelo
+ * apaga la NTT mientras dura el producto (reserva su propia memoria en cada llamada); así también
+ * la corrida con un hilo usa el mismo algoritmo que las de varios y la aceleración es comparable.
+ *
+ * Compilar con -pthread.
+ */
+
+// Limbs por debajo de los cuales crear un hilo cuesta más de lo que se gana
+#define GRANO_KARATSUBA_PARALELO 256
+
+/**
+ * profundidadKaratsuba - Niveles paralelos para ocupar los hilos dados
+ *
+ * Cada nivel triplica las tareas, así que basta con ceil(log3(hilos)) niveles.
+ */
+static inline int profundidadKaratsuba(int hilos) {
+    int profundidad = 0;
+    for (long tareas = 1; tareas < hilos; tareas *= 3) {
+        profundidad++;
+    }
+    return profundidad;
+}
+
+/**
+ * scratchKaratsubaParalelo - Limbs temporales para karatsubaParalelo con n limbs
+ *
+ * En un nivel paralelo: 6m + 1 limbs del propio nivel más un pedazo independiente para cada
+ * una de las tres tareas (de m o de h = n - m limbs).
+ */
+static inline size_t scratchTareaKaratsuba(size_t n, int profundidad);
+
+static inline size_t scratchKaratsubaParalelo(size_t n, int profundidad) {
+    if (profundidad <= 0 || n < GRANO_KARATSUBA_PARALELO) {
+        return scratchBalanceado(n);
+    }
+    size_t m = (n + 1) / 2;
+    return 6 * m + 1 + 3 * scratchTareaKaratsuba(n, profundidad);
+}
+
+// Pedazo de cada tarea de un nivel paralelo sobre n limbs: alcanza para m y para h limbs
+static inline size_t scratchTareaKaratsuba(size_t n, int profundidad) {
+    size_t m = (n + 1) / 2;
+    size_t conM = scratchKaratsubaParalelo(m, profundidad - 1);
+    size_t conH = scratchKaratsubaParalelo(n - m, profundidad - 1);
+    return conM > conH ? conM : conH;
+}
+
+typedef struct {
+    Limb *r;
+    const Limb *a;
+    const Limb *b;
+    size_t n;
+    Limb *scratch;
+    int profundidad;
+} TareaKaratsuba;
+
+static void *ejecutarTareaKaratsuba(void *arg);
+
+/**
+ * karatsubaParalelo - r = a * b para dos magnitudes de n limbs
+ * @r: 2n limbs, distinto de a y b
+ * @scratch: al menos scratchKaratsubaParalelo(n, profundidad) limbs
+ * @profundidad: niveles en los que se crean hilos (ver profundidadKaratsuba)
+ *
+ * Misma descomposición que karatsubaLimbs. Si no se puede crear un hilo, su tarea se hace en el
+ * hilo actual.
+ */
+static void karatsubaParalelo(Limb *r, const Limb *a, const Limb *b, size_t n, Limb *scratch, int profundidad) {
+    if (profundidad <= 0 || n < GRANO_KARATSUBA_PARALELO) {
+        multiplicarBalanceado(r, a, b, n, scratch);
+        return;
+    }
+    size_t m = (n + 1) / 2, h = n - m;
+    size_t porTarea = scratchTareaKaratsuba(n, profundidad);
+    Limb *da = scratch;
+    Limb *db = da + m;
+    Limb *z1 = db + m;
+    Limb *medio = z1 + 2 * m;
+    Limb *resto = medio + 2 * m + 1;
+
+    int negativo = diferenciaAbsoluta(da, a, m, a + m, h);
+    negativo ^= diferenciaAbsoluta(db, b, m, b + m, h);
+
+    TareaKaratsuba tareas[2] = {
+        {r, a, b, m, resto, profundidad - 1},
+        {r + 2 * m, a + m, b + m, h, resto + porTarea, profundidad - 1},
+    };
+    pthread_t hilos[2];
+    int conHilo[2];
+    for (int t = 0; t < 2; t++) {
+        conHilo[t] = pthread_create(&hilos[t], NULL, ejecutarTareaKaratsuba, &tareas[t]) == 0;
+        if (!conHilo[t]) {
+            ejecutarTareaKaratsuba(&tareas[t]);
+        }
+    }
+    karatsubaParalelo(z1, da, db, m, resto + 2 * porTarea, profundidad - 1);
+    for (int t = 0; t < 2; t++) {
+        if (conHilo[t]) {
+            pthread_join(hilos[t], NULL);
+        }
+    }
+    combinarKaratsuba(r, z1, medio, n, negativo);
+}
+
+static void *ejecutarTareaKaratsuba(void *arg) {
+    TareaKaratsuba *tarea = (TareaKaratsuba *)arg;
+    karatsubaParalelo(tarea->r, tarea->a, tarea->b, tarea->n, tarea->scratch, tarea->profundidad);
+    return NULL;
+}
+
+/**
+ * multiplicarParalelo - r = a * b para magnitudes de cualquier longitud, con hasta `hilos` hilos
+ * @r: na + nb limbs, distinto de a y b
+ *
+ * Reserva toda la memoria temporal de una vez y no usa la NTT. Con operandos desbalanceados el
+ * largo se corta en trozos del tamaño del corto y cada trozo se multiplica en paralelo.
+ * Retorna: 1 si se calculó el producto, 0 si faltó memoria
+ */
+static inline int multiplicarParalelo(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb, int hilos) {
+    if (na < nb) {
+        const Limb *t = a;
+        a = b;
+        b = t;
+        size_t tn = na;
+        na = nb;
+        nb = tn;
+    }
+    if (nb == 0) {
+        memset(r, 0, na * sizeof(Limb));
+        return 1;
+    }
+    int profundidad = profundidadKaratsuba(hilos);
+    size_t trozoYRelleno = na == nb ? 0 : 3 * nb;
+    Limb *scratch = malloc((trozoYRelleno + scratchKaratsubaParalelo(nb, profundidad) + 1) * sizeof(Limb));
+    if (scratch == NULL) {
+        return 0;
+    }
+    // Las hojas se quedan en Karatsuba y Toom-3, que usan la memoria ya reservada
+    size_t umbralNTT = umbrales.ntt;
+    umbrales.ntt = SIZE_MAX;
+    if (na == nb) {
+        karatsubaParalelo(r, a, b, nb, scratch, profundidad);
+        umbrales.ntt = umbralNTT;
+        free(scratch);
+        return 1;
+    }
+    Limb *trozo = scratch;
+    Limb *relleno = trozo + 2 * nb;
+    Limb *resto = relleno + nb;
+    memset(r, 0, (na + nb) * sizeof(Limb));
+    for (size_t i = 0; i < na; i += nb) {
+        size_t lon = na - i < nb ? na - i : nb;
+        const Limb *pedazo = a + i;
+        if (lon < nb) {
+            memcpy(relleno, a + i, lon * sizeof(Limb));
+            memset(relleno + lon, 0, (nb - lon) * sizeof(Limb));
+            pedazo = relleno;
+        }
+        karatsubaParalelo(trozo, pedazo, b, nb, resto, profundidad);
+        Limb acarreo = sumarLimbs(r + i, r + i, lon + nb, trozo, lon + nb);
+        for (size_t j = i + lon + nb; acarreo && j < na + nb; j++) {
+            r[j] += acarreo;
+            acarreo = r[j] == 0;
+        }
+    }
+    umbrales.ntt = umbralNTT;
+    free(scratch);
+    return 1;
+}
+
+#endif
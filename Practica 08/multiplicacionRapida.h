@@ -0,0 +1,551 @@
+#ifndef MULTIPLICACION_RAPIDA_H
+#define MULTIPLICACION_RAPIDA_H
+
+#include "granEntero.h"
+
+/*
+ * Niveles de multiplicación por encima de Karatsuba
+ *
+ * Según el tamaño del operando más corto (en limbs de 64 bits):
+ *   n < umbralKaratsuba            escolar, O(n²)
+ *   n < umbrales.toom3             Karatsuba, O(n^1.585)
+ *   n < umbrales.ntt               Toom-3, O(n^1.465)
+ *   en adelante                    NTT con tres primos y CRT, O(n log n)
+ *
+ * Los umbrales por defecto salen de karatsubaMultiply --calibrar en un x86-64 actual: ahí la NTT
+ * empata con Toom-3 hacia los 24k limbs y gana claramente desde 32k, así que antes de ese tamaño
+ * no conviene. --calibrar mide los cruces en la máquina y los guarda en un archivo que
+ * cargarUmbrales vuelve a leer.
+ *
+ * Toom-3 parte cada operando en tres pedazos de k limbs, evalúa en 0, 1, -1, -2 e infinito, hace
+ * cinco productos recursivos y los interpola con la secuencia de Bodrato. Los valores intermedios
+ * que pueden ser negativos se guardan en complemento a dos sobre 2k + 2 limbs: suma y resta son
+ * las mismas de las magnitudes y las divisiones exactas entre 2 y 3 se hacen limb por limb.
+ */
+
+typedef struct {
+    size_t toom3;   // Limbs desde los que se usa Toom-3
+    size_t ntt;     // Limbs desde los que se usa la NTT
+} UmbralesMultiplicacion;
+
+static UmbralesMultiplicacion umbrales = {384, 24576};
+
+// Toom-3 necesita al menos tres pedazos no vacíos
+#define MINIMO_TOOM3 16
+
+// Con dígitos de 32 bits cada coeficiente de la convolución vale a lo más L * 2^64, que debe
+// quedar por debajo del producto de los tres primos (~2^86): L <= 2^22 dígitos por operando.
+// Además 2^23 es la mayor longitud que admite 998244353 = 119 * 2^23 + 1.
+#define MAXIMO_DIGITOS_NTT (1u << 22)
+#define MAXIMA_LONGITUD_NTT (1u << 23)
+
+/**
+ * negarLimbs - a = -a en complemento a dos sobre n limbs
+ */
+static inline void negarLimbs(Limb *a, size_t n) {
+    Limb acarreo = 1;
+    for (size_t i = 0; i < n; i++) {
+        a[i] = ~a[i] + acarreo;
+        acarreo = acarreo && a[i] == 0;
+    }
+}
+
+/**
+ * mitadLimbs - a = a / 2 (desplazamiento aritmético) en complemento a dos sobre n limbs
+ */
+static inline void mitadLimbs(Limb *a, size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        a[i] = (a[i] >> 1) | (a[i + 1] << 63);
+    }
+    a[n - 1] = (Limb)((int64_t)a[n - 1] >> 1);
+}
+
+/**
+ * dobleLimbs - a = 2a sobre n limbs
+ */
+static inline void dobleLimbs(Limb *a, size_t n) {
+    for (size_t i = n; i-- > 1;) {
+        a[i] = (a[i] << 1) | (a[i - 1] >> 63);
+    }
+    a[0] <<= 1;
+}
+
+/**
+ * divisionExacta3 - a = a / 3 para un múltiplo de 3 en complemento a dos sobre n limbs
+ *
+ * Cada limb del cociente es (limb - préstamo) * 3^-1 mod 2^64; lo que sobra de q * 3 se
+ * arrastra como préstamo al siguiente limb. No hay divisiones de hardware.
+ */
+static inline void divisionExacta3(Limb *a, size_t n) {
+    const Limb inverso3 = 0xAAAAAAAAAAAAAAABull;
+    Limb prestamo = 0;
+    for (size_t i = 0; i < n; i++) {
+        Limb s = a[i];
+        Limb l = s - prestamo;
+        prestamo = l > s;
+        Limb q = l * inverso3;
+        a[i] = q;
+        prestamo += (Limb)(((unsigned __int128)q * 3) >> 64);
+    }
+}
+
+/**
+ * acumularLimbs - r += c, con r de nr limbs y c de nc limbs
+ *
+ * Los limbs de c que no caben en r deben ser cero (el resultado completo cabe en r).
+ */
+static inline void acumularLimbs(Limb *r, size_t nr, const Limb *c, size_t nc) {
+    sumarLimbs(r, r, nr, c, nc < nr ? nc : nr);
+}
+
+/**
+ * evaluarToom3 - Evalúa x = x2*t² + x1*t + x0 en t = 1, -1 y -2
+ * @x: operando; x0 y x1 tienen k limbs, x2 tiene h <= k limbs
+ * @p1, @pm1, @pm2: k + 1 limbs cada uno; pm1 y pm2 guardan |x(-1)| y |x(-2)|
+ * @negativoM2: se pone en 1 si x(-2) es negativo
+ *
+ * Retorna: 1 si x(-1) es negativo
+ */
+static inline int evaluarToom3(const Limb *x, size_t k, size_t h, Limb *p1, Limb *pm1, Limb *pm2, int *negativoM2) {
+    const Limb *x0 = x, *x1 = x + k, *x2 = x + 2 * k;
+    // x(-2) = (x0 + 4*x2) - 2*x1; p1 sirve de temporal para 2*x1. |x(-2)| < 5 * B^k
+    memcpy(pm2, x2, h * sizeof(Limb));
+    memset(pm2 + h, 0, (k + 1 - h) * sizeof(Limb));
+    dobleLimbs(pm2, k + 1);
+    dobleLimbs(pm2, k + 1);
+    sumarLimbs(pm2, pm2, k + 1, x0, k);
+    memcpy(p1, x1, k * sizeof(Limb));
+    p1[k] = 0;
+    dobleLimbs(p1, k + 1);
+    *negativoM2 = diferenciaAbsoluta(pm2, pm2, k + 1, p1, k + 1);
+    // p1 = x0 + x2 y con eso x(-1) = (x0 + x2) - x1 y x(1) = (x0 + x2) + x1
+    p1[k] = sumarLimbs(p1, x0, k, x2, h);
+    int negativo = diferenciaAbsoluta(pm1, p1, k + 1, x1, k);
+    sumarLimbs(p1, p1, k + 1, x1, k);
+    return negativo;
+}
+
+static int multiplicarNTT(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb);
+static void toom3Limbs(Limb *r, const Limb *a, const Limb *b, size_t n, Limb *scratch);
+
+/**
+ * nttAplica - Indica si la NTT de tres primos alcanza para un producto de na x nb limbs
+ */
+static inline int nttAplica(size_t na, size_t nb) {
+    size_t digitos = 2 * (na + nb);
+    return 2 * (na < nb ? na : nb) <= MAXIMO_DIGITOS_NTT && digitos <= MAXIMA_LONGITUD_NTT;
+}
+
+/**
+ * scratchBalanceado - Limbs temporales para multiplicarBalanceado con n limbs
+ *
+ * Un nivel de Toom-3 usa 6(k+1) limbs para las evaluaciones y 3(2k+2) para los productos; la NTT
+ * reserva su propia memoria, así que no cuenta aquí.
+ */
+static inline size_t scratchBalanceado(size_t n) {
+    if (n < umbralKaratsuba) {
+        return 0;
+    }
+    if (n >= umbrales.toom3 && n >= MINIMO_TOOM3) {
+        size_t k = (n + 2) / 3;
+        // Los productos son de k + 1, k y n - 2k limbs; el mayor no siempre pide más memoria
+        size_t debajo = scratchBalanceado(k + 1);
+        size_t debajoK = scratchBalanceado(k);
+        size_t debajoH = scratchBalanceado(n - 2 * k);
+        debajo = debajo > debajoK ? debajo : debajoK;
+        return 6 * (k + 1) + 3 * (2 * k + 2) + (debajo > debajoH ? debajo : debajoH);
+    }
+    return scratchKaratsuba(n);
+}
+
+/**
+ * multiplicarBalanceado - r = a * b para dos magnitudes de n limbs, eligiendo el nivel por tamaño
+ * @r: 2n limbs, distinto de a y b
+ * @scratch: al menos scratchBalanceado(n) limbs
+ */
+static inline void multiplicarBalanceado(Limb *r, const Limb *a, const Limb *b, size_t n, Limb *scratch) {
+    if (n < umbralKaratsuba || n == 1) {
+        multiplicacionEscolar(r, a, n, b, n);
+    } else if (n >= umbrales.ntt && nttAplica(n, n) && multiplicarNTT(r, a, n, b, n)) {
+        return;
+    } else if (n >= umbrales.toom3 && n >= MINIMO_TOOM3) {
+        toom3Limbs(r, a, b, n, scratch);
+    } else {
+        karatsubaLimbs(r, a, b, n, scratch);
+    }
+}
+
+/**
+ * toom3Limbs - r = a * b para dos magnitudes de n limbs con Toom-3
+ * @r: 2n limbs, distinto de a y b
+ * @scratch: al menos scratchBalanceado(n) limbs
+ *
+ * Con k = ceil(n/3), a(t) = a2*t² + a1*t + a0 y b(t) igual, el producto c(t) = a(t)*b(t) tiene
+ * cinco coeficientes y c(B^k) = a*b. Se calcula c en 0, 1, -1, -2 e infinito y se interpola:
+ *   c3 = (c(-2) - c(1)) / 3       c1 = (c(1) - c(-1)) / 2        c2 = c(-1) - c(0)
+ *   c3 = (c2 - c3) / 2 + 2c(inf)   c2 = c2 + c1 - c(inf)          c1 = c1 - c3
+ * c(0) y c(inf) se escriben directo en su lugar de r; c1, c2 y c3 se suman al final.
+ */
+static void toom3Limbs(Limb *r, const Limb *a, const Limb *b, size_t n, Limb *scratch) {
+    size_t k = (n + 2) / 3, h = n - 2 * k;
+    size_t e = k + 1, w = 2 * k + 2;
+    Limb *pa1 = scratch, *pam1 = pa1 + e, *pam2 = pam1 + e;
+    Limb *pb1 = pam2 + e, *pbm1 = pb1 + e, *pbm2 = pbm1 + e;
+    Limb *c1 = pbm2 + e;      // c(1), luego el coeficiente 1
+    Limb *cm1 = c1 + w;       // c(-1), luego el coeficiente 2
+    Limb *cm2 = cm1 + w;      // c(-2), luego el coeficiente 3
+    Limb *resto = cm2 + w;
+
+    int negativoA2, negativoB2;
+    int negativo = evaluarToom3(a, k, h, pa1, pam1, pam2, &negativoA2);
+    negativo ^= evaluarToom3(b, k, h, pb1, pbm1, pbm2, &negativoB2);
+
+    multiplicarBalanceado(c1, pa1, pb1, e, resto);
+    multiplicarBalanceado(cm1, pam1, pbm1, e, resto);
+    if (negativo) {
+        negarLimbs(cm1, w);
+    }
+    multiplicarBalanceado(cm2, pam2, pbm2, e, resto);
+    if (negativoA2 != negativoB2) {
+        negarLimbs(cm2, w);
+    }
+    // c(0) = a0*b0 en r[0..2k) y c(inf) = a2*b2 en r[4k..2n); en medio, ceros
+    multiplicarBalanceado(r, a, b, k, resto);
+    memset(r + 2 * k, 0, 2 * k * sizeof(Limb));
+    multiplicarBalanceado(r + 4 * k, a + 2 * k, b + 2 * k, h, resto);
+    const Limb *c0 = r, *cinf = r + 4 * k;
+
+    // Interpolación de Bodrato, en complemento a dos sobre w limbs
+    restarLimbs(cm2, cm2, w, c1, w);
+    divisionExacta3(cm2, w);                // cm2 <- (c(-2) - c(1)) / 3
+    restarLimbs(c1, c1, w, cm1, w);
+    mitadLimbs(c1, w);                      // c1 <- (c(1) - c(-1)) / 2
+    restarLimbs(cm1, cm1, w, c0, 2 * k);    // cm1 <- c(-1) - c(0)
+    restarLimbs(cm2, cm1, w, cm2, w);
+    mitadLimbs(cm2, w);
+    sumarLimbs(cm2, cm2, w, cinf, 2 * h);
+    sumarLimbs(cm2, cm2, w, cinf, 2 * h);   // cm2 <- coeficiente 3
+    sumarLimbs(cm1, cm1, w, c1, w);
+    restarLimbs(cm1, cm1, w, cinf, 2 * h);  // cm1 <- coeficiente 2
+    restarLimbs(c1, c1, w, cm2, w);         // c1 <- coeficiente 1
+
+    acumularLimbs(r + k, 2 * n - k, c1, w);
+    acumularLimbs(r + 2 * k, 2 * n - 2 * k, cm1, w);
+    acumularLimbs(r + 3 * k, 2 * n - 3 * k, cm2, w);
+}
+
+/**
+ * scratchRapido - Limbs temporales para multiplicarRapido con operandos de na y nb limbs
+ */
+static inline size_t scratchRapido(size_t na, size_t nb) {
+    size_t corto = na < nb ? na : nb;
+    return 3 * corto + scratchBalanceado(corto);
+}
+
+/**
+ * multiplicarRapido - r = a * b para magnitudes de cualquier longitud, con el mejor nivel
+ * @r: na + nb limbs, distinto de a y b
+ * @scratch: al menos scratchRapido(na, nb) limbs
+ *
+ * La NTT acepta operandos desbalanceados tal cual; para los demás niveles el operando largo se
+ * corta en trozos del tamaño del corto, como en multiplicarLimbs.
+ */
+static inline void multiplicarRapido(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb, Limb *scratch) {
+    if (na < nb) {
+        const Limb *t = a;
+        a = b;
+        b = t;
+        size_t tn = na;
+        na = nb;
+        nb = tn;
+    }
+    if (nb == 0) {
+        memset(r, 0, na * sizeof(Limb));
+        return;
+    }
+    if (nb < umbralKaratsuba) {
+        multiplicacionEscolar(r, a, na, b, nb);
+        return;
+    }
+    if (nb >= umbrales.ntt && nttAplica(na, nb) && multiplicarNTT(r, a, na, b, nb)) {
+        return;
+    }
+    if (na == nb) {
+        multiplicarBalanceado(r, a, b, nb, scratch);
+        return;
+    }
+    Limb *trozo = scratch;
+    Limb *relleno = trozo + 2 * nb;
+    Limb *resto = relleno + nb;
+    memset(r, 0, (na + nb) * sizeof(Limb));
+    for (size_t i = 0; i < na; i += nb) {
+        size_t lon = na - i < nb ? na - i : nb;
+        const Limb *pedazo = a + i;
+        if (lon < nb) {
+            memcpy(relleno, a + i, lon * sizeof(Limb));
+            memset(relleno + lon, 0, (nb - lon) * sizeof(Limb));
+            pedazo = relleno;
+        }
+        multiplicarBalanceado(trozo, pedazo, b, nb, resto);
+        Limb acarreo = sumarLimbs(r + i, r + i, lon + nb, trozo, lon + nb);
+        for (size_t j = i + lon + nb; acarreo && j < na + nb; j++) {
+            r[j] += acarreo;
+            acarreo = r[j] == 0;
+        }
+    }
+}
+
+/*
+ * NTT (transformada teórica de números) con tres primos de la forma c * 2^k + 1, todos con raíz
+ * primitiva 3. El producto se calcula módulo cada primo y los tres residuos de cada coeficiente se
+ * combinan con el teorema chino del residuo (Garner) en un valor de hasta 86 bits.
+ *
+ * Dentro de la transformada los valores van en forma de Montgomery (x * 2^32 mod p), así cada
+ * producto modular son tres multiplicaciones enteras en lugar de una división de 64 bits.
+ */
+#define PRIMO_NTT_1 998244353u   // 119 * 2^23 + 1
+#define PRIMO_NTT_2 167772161u   // 5 * 2^25 + 1
+#define PRIMO_NTT_3 469762049u   // 7 * 2^26 + 1
+#define RAIZ_NTT 3u
+
+static inline uint32_t potenciaModular(uint32_t base, uint64_t exp, uint32_t p) {
+    uint64_t resultado = 1, b = base % p;
+    while (exp > 0) {
+        if (exp & 1) {
+            resultado = resultado * b % p;
+        }
+        b = b * b % p;
+        exp >>= 1;
+    }
+    return (uint32_t)resultado;
+}
+
+typedef struct {
+    uint32_t p;
+    uint32_t negInverso;   // -p^-1 mod 2^32
+    uint32_t r2;           // 2^64 mod p, para pasar a forma de Montgomery
+} ModuloNTT;
+
+static inline ModuloNTT moduloNTT(uint32_t p) {
+    ModuloNTT m;
+    m.p = p;
+    // Newton: cada iteración duplica los bits correctos del inverso (p es impar)
+    uint32_t inverso = p;
+    for (int i = 0; i < 5; i++) {
+        inverso *= 2 - p * inverso;
+    }
+    m.negInverso = 0u - inverso;
+    m.r2 = (uint32_t)(((unsigned __int128)1 << 64) % p);
+    return m;
+}
+
+/**
+ * reducirMontgomery - t * 2^-32 mod p para t < p * 2^32; resultado en [0, p)
+ */
+static inline uint32_t reducirMontgomery(uint64_t t, const ModuloNTT *m) {
+    uint32_t q = (uint32_t)t * m->negInverso;
+    uint32_t u = (uint32_t)((t + (uint64_t)q * m->p) >> 32);
+    return u >= m->p ? u - m->p : u;
+}
+
+static inline uint32_t productoMontgomery(uint32_t a, uint32_t b, const ModuloNTT *m) {
+    return reducirMontgomery((uint64_t)a * b, m);
+}
+
+/**
+ * transformadaNTT - NTT iterativa en sitio (Cooley–Tukey) de longitud L (potencia de 2)
+ * @f: valores en forma de Montgomery
+ * @raices: L/2 valores de trabajo para las potencias de la raíz de cada etapa
+ * @inversa: 1 para la transformada inversa (sin la división entre L)
+ */
+static inline void transformadaNTT(uint32_t *f, size_t L, const ModuloNTT *m, int inversa, uint32_t *raices) {
+    uint32_t p = m->p;
+    for (size_t i = 1, j = 0; i < L; i++) {
+        size_t bit = L >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            uint32_t t = f[i];
+            f[i] = f[j];
+            f[j] = t;
+        }
+    }
+    for (size_t lon = 2; lon <= L; lon <<= 1) {
+        uint32_t w = potenciaModular(RAIZ_NTT, (p - 1) / lon, p);
+        if (inversa) {
+            w = potenciaModular(w, p - 2, p);
+        }
+        w = productoMontgomery(w, m->r2, m);
+        size_t mitad = lon / 2;
+        raices[0] = productoMontgomery(1, m->r2, m);
+        for (size_t j = 1; j < mitad; j++) {
+            raices[j] = productoMontgomery(raices[j - 1], w, m);
+        }
+        for (size_t i = 0; i < L; i += lon) {
+            for (size_t j = 0; j < mitad; j++) {
+                uint32_t u = f[i + j];
+                uint32_t v = productoMontgomery(f[i + j + mitad], raices[j], m);
+                f[i + j] = u + v >= p ? u + v - p : u + v;
+                f[i + j + mitad] = u >= v ? u - v : u + p - v;
+            }
+        }
+    }
+}
+
+// Dígito i de 32 bits de un arreglo de limbs
+static inline uint32_t digito32(const Limb *a, size_t i) {
+    return (uint32_t)(a[i / 2] >> (32 * (i & 1)));
+}
+
+/**
+ * convolucionModular - Producto de a y b módulo p, coeficiente por coeficiente, en res
+ */
+static inline void convolucionModular(const Limb *a, size_t na, const Limb *b, size_t nb, size_t L, uint32_t p,
+                                      uint32_t *fa, uint32_t *fb, uint32_t *raices, uint32_t *res, size_t nres) {
+    ModuloNTT m = moduloNTT(p);
+    // Un dígito de 32 bits por r2 (< p) cabe en la reducción: queda x * 2^32 mod p
+    for (size_t i = 0; i < L; i++) {
+        fa[i] = i < 2 * na ? productoMontgomery(digito32(a, i), m.r2, &m) : 0;
+        fb[i] = i < 2 * nb ? productoMontgomery(digito32(b, i), m.r2, &m) : 0;
+    }
+    transformadaNTT(fa, L, &m, 0, raices);
+    transformadaNTT(fb, L, &m, 0, raices);
+    for (size_t i = 0; i < L; i++) {
+        fa[i] = productoMontgomery(fa[i], fb[i], &m);
+    }
+    transformadaNTT(fa, L, &m, 1, raices);
+    // Multiplicar por L^-1 en forma normal saca a la vez de la forma de Montgomery
+    uint32_t inversoL = potenciaModular((uint32_t)(L % p), p - 2, p);
+    for (size_t i = 0; i < nres; i++) {
+        res[i] = productoMontgomery(fa[i], inversoL, &m);
+    }
+}
+
+/**
+ * multiplicarNTT - r = a * b con la NTT de tres primos
+ * @r: na + nb limbs, distinto de a y b
+ *
+ * Trabaja con dígitos de 32 bits. Reserva su propia memoria (unos 20 bytes por dígito del
+ * producto). Retorna: 1 si calculó el producto, 0 si no aplica (ver nttAplica) o faltó memoria
+ */
+static int multiplicarNTT(Limb *r, const Limb *a, size_t na, const Limb *b, size_t nb) {
+    if (!nttAplica(na, nb)) {
+        return 0;
+    }
+    size_t digitos = 2 * (na + nb);
+    size_t L = 1;
+    while (L < digitos) {
+        L <<= 1;
+    }
+    uint32_t *fa = malloc(L * sizeof(uint32_t));
+    uint32_t *fb = malloc(L * sizeof(uint32_t));
+    uint32_t *raices = malloc((L / 2 + 1) * sizeof(uint32_t));
+    uint32_t *res = malloc(3 * digitos * sizeof(uint32_t));
+    if (fa == NULL || fb == NULL || raices == NULL || res == NULL) {
+        free(fa);
+        free(fb);
+        free(raices);
+        free(res);
+        return 0;
+    }
+    uint32_t *r1 = res, *r2 = res + digitos, *r3 = res + 2 * digitos;
+    convolucionModular(a, na, b, nb, L, PRIMO_NTT_1, fa, fb, raices, r1, digitos);
+    convolucionModular(a, na, b, nb, L, PRIMO_NTT_2, fa, fb, raices, r2, digitos);
+    convolucionModular(a, na, b, nb, L, PRIMO_NTT_3, fa, fb, raices, r3, digitos);
+
+    // Garner: x = x1 + p1*v2 + p1*p2*v3, con cada v en su propio módulo
+    const uint64_t p1 = PRIMO_NTT_1, p2 = PRIMO_NTT_2, p3 = PRIMO_NTT_3;
+    const uint64_t inv1en2 = potenciaModular((uint32_t)(p1 % p2), p2 - 2, (uint32_t)p2);
+    const uint64_t p12 = p1 * p2;
+    const uint64_t inv12en3 = potenciaModular((uint32_t)(p12 % p3), p3 - 2, (uint32_t)p3);
+    unsigned __int128 acarreo = 0;
+    memset(r, 0, (na + nb) * sizeof(Limb));
+    for (size_t i = 0; i < digitos; i++) {
+        uint64_t x1 = r1[i];
+        uint64_t v2 = (r2[i] + p2 - x1 % p2) % p2 * inv1en2 % p2;
+        uint64_t x12 = x1 + p1 * v2;
+        uint64_t v3 = (r3[i] + p3 - x12 % p3) % p3 * inv12en3 % p3;
+        acarreo += (unsigned __int128)p12 * v3 + x12;
+        r[i / 2] |= (Limb)(uint32_t)acarreo << (32 * (i & 1));
+        acarreo >>= 32;
+    }
+
+    free(fa);
+    free(fb);
+    free(raices);
+    free(res);
+    return 1;
+}
+
+/**
+ * granMultiplicarRapido - r = x * y con el nivel que corresponda a su tamaño
+ *
+ * Igual que granMultiplicar, pero usa multiplicarRapido. Retorna: 1 si todo salió bien, 0 si
+ * faltó memoria
+ */
+static inline int granMultiplicarRapido(GranEntero *r, const GranEntero *x, const GranEntero *y) {
+    if (!granReservar(r, x->n + y->n)) {
+        return 0;
+    }
+    if (x->n == 0 || y->n == 0) {
+        return 1;
+    }
+    Limb *scratch = malloc((scratchRapido(x->n, y->n) + 1) * sizeof(Limb));
+    if (scratch == NULL) {
+        granLiberar(r);
+        return 0;
+    }
+    multiplicarRapido(r->limbs, x->limbs, x->n, y->limbs, y->n, scratch);
+    free(scratch);
+    r->n = limbsSignificativos(r->limbs, x->n + y->n);
+    r->negativo = r->n > 0 && (x->negativo != y->negativo);
+    return 1;
+}
+
+/**
+ * cargarUmbrales - Lee los umbrales de un archivo de la forma "nombre valor" por línea
+ *
+ * Nombres reconocidos: karatsuba, toom3, ntt. Las líneas que empiezan con '#' se ignoran.
+ * Retorna: 1 si el archivo existía, 0 si no (los umbrales no cambian)
+ */
+static inline int cargarUmbrales(const char *ruta) {
+    FILE *archivo = fopen(ruta, "r");
+    if (archivo == NULL) {
+        return 0;
+    }
+    char linea[128], nombre[32];
+    unsigned long long valor;
+    while (fgets(linea, sizeof(linea), archivo) != NULL) {
+        if (linea[0] == '#' || sscanf(linea, "%31s %llu", nombre, &valor) != 2 || valor < 2) {
+            continue;
+        }
+        if (strcmp(nombre, "karatsuba") == 0) {
+            umbralKaratsuba = (size_t)valor;
+        } else if (strcmp(nombre, "toom3") == 0) {
+            umbrales.toom3 = (size_t)valor;
+        } else if (strcmp(nombre, "ntt") == 0) {
+            umbrales.ntt = (size_t)valor;
+        }
+    }
+    fclose(archivo);
+    return 1;
+}
+
+/**
+ * guardarUmbrales - Escribe los umbrales actuales en el formato de cargarUmbrales
+ *
+ * Retorna: 1 si se pudo escribir el archivo
+ */
+static inline int guardarUmbrales(const char *ruta) {
+    FILE *archivo = fopen(ruta, "w");
+    if (archivo == NULL) {
+        return 0;
+    }
+    fprintf(archivo, "# Umbrales de multiplicacion en limbs de 64 bits (karatsubaMultiply --calibrar)\n");
+    fprintf(archivo, "karatsuba %zu\ntoom3 %zu\nntt %zu\n", umbralKaratsuba, umbrales.toom3, umbrales.ntt);
+    return fclose(archivo) == 0;
+}
+
+#endif
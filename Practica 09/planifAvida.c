@@ -1,40 +1,85 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <time.h>
+#include "../Comun/generador.h"
+#include "../Comun/medicion.h"
+#include "../Comun/intervalos.h"
+
+/**
+ * Compilación: gcc planifAvida.c -o planifAvida
+ * Ejecución:   ./planifAvida                          Ejemplo de la práctica con los tres criterios
+ *              ./planifAvida (--entrada archivo | --generar {n}) [--criterio c] [--semilla s] [--imprimir]
+ *                  Lee las actividades de un archivo (ver Comun/intervalos.h: CSV "id,inicio,fin[,peso]"
+ *                  o binario .ivl) o genera n al azar, y mide por separado el ordenamiento y la
+ *                  selección con el criterio c (1: inicio, 2: finalización, 3: duración; por
+ *                  defecto los tres). Con --imprimir también escribe la decisión sobre cada actividad.
+ *              ./planifAvida --ponderado (--entrada archivo | --generar {n}) [--semilla s] [--imprimir]
+ *                  Elige actividades compatibles con el mayor peso total. Con --imprimir lista las
+ *                  actividades elegidas.
+ *              Opciones comunes:
+ *                  --reloj h          Los tiempos del archivo son horas de reloj (930 = 9:30) y las
+ *                                     menores que h son de la tarde; se convierten a minutos
+ *                  --guardar a.ivl    Guarda las actividades leídas o generadas en binario
+ */
 
 // Definición de la estructura para representar una actividad
 typedef struct {
-    char nombre;           // Identificador de la actividad
-    int inicio;           // Tiempo de inicio
-    int fin;              // Tiempo de finalización
+    long long id;         // Identificador de la actividad
+    long long inicio;     // Tiempo de inicio
+    long long fin;        // Tiempo de finalización
+    long long peso;       // Prioridad, para la selección ponderada
 } Actividad;
 
 // Función para calcular la duración de una actividad
-int calcularDuracion(Actividad a) {
+long long calcularDuracion(Actividad a) {
     return a.fin - a.inicio;
 }
 
-// Función de comparación para ordenar por tiempo de inicio
+// Encabezado de cada criterio (el índice es el número de criterio)
+static const char *const NOMBRES_CRITERIO[] = {
+    "", "Criterio de Tiempo de Inicio", "Criterio de Tiempo de FInalizacion", "Criterio de Tiempo de Duracion"
+};
+
+// Imprime si la actividad se seleccionó o se rechazó
+void imprimirDecision(Actividad a, int seleccionada) {
+    if (seleccionada) {
+        printf("Seleccionada: %lld [%lld, %lld] - Duracion: %lld\n", 
+               a.id, a.inicio, a.fin, calcularDuracion(a));
+    } else {
+        printf("Rechazada:    %lld [%lld, %lld] - Se traslapa con otra actividad\n", 
+               a.id, a.inicio, a.fin);
+    }
+}
+
+// Compara dos enteros sin restarlos (la resta se desborda con tiempos grandes)
+int compararEnteros(long long x, long long y) {
+    return (x > y) - (x < y);
+}
+
+// Función de comparación para ordenar por tiempo de inicio (empates: primero la que termina antes)
 int compararPorInicio(const void *a, const void *b) {
     Actividad *act1 = (Actividad *)a;
     Actividad *act2 = (Actividad *)b;
-    return act1->inicio - act2->inicio;
+    int c = compararEnteros(act1->inicio, act2->inicio);
+    return c != 0 ? c : compararEnteros(act1->fin, act2->fin);
 }
 
-// Función de comparación para ordenar por tiempo de finalización
+// Función de comparación para ordenar por tiempo de finalización (empates: primero la que empieza antes)
 int compararPorFin(const void *a, const void *b) {
     Actividad *act1 = (Actividad *)a;
     Actividad *act2 = (Actividad *)b;
-    return act1->fin - act2->fin;
+    int c = compararEnteros(act1->fin, act2->fin);
+    return c != 0 ? c : compararEnteros(act1->inicio, act2->inicio);
 }
 
-// Función de comparación para ordenar por duración (menor a mayor)
+// Función de comparación para ordenar por duración (menor a mayor; empates: primero la que empieza antes)
 int compararPorDuracion(const void *a, const void *b) {
     Actividad *act1 = (Actividad *)a;
     Actividad *act2 = (Actividad *)b;
-    int duracion1 = calcularDuracion(*act1);
-    int duracion2 = calcularDuracion(*act2);
-    return duracion1 - duracion2;
+    int c = compararEnteros(calcularDuracion(*act1), calcularDuracion(*act2));
+    return c != 0 ? c : compararEnteros(act1->inicio, act2->inicio);
 }
 
 // Función que verifica si dos actividades son compatibles (no se traslapan)
@@ -43,69 +88,322 @@ int sonCompatibles(Actividad a1, Actividad a2) {
     return (a1.fin <= a2.inicio || a2.fin <= a1.inicio);
 }
 
-// Función que implementa el algoritmo ávido para seleccionar actividades
-void seleccionarActividades(Actividad actividades[], int n, int criterio) {
-    // Crear una copia del arreglo para no modificar el original
-    Actividad *copia = (Actividad *)malloc(n * sizeof(Actividad));
-    memcpy(copia, actividades, n * sizeof(Actividad));
-    
-    // Ordenar según el criterio seleccionado
+// Primera posición de un arreglo ordenado de m enteros con valor mayor que t (m si no hay).
+// Búsqueda binaria sin saltos: el nuevo inicio se elige con una expresión condicional que el
+// compilador traduce a cmov
+int primerMayorQue(const long long valores[], int m, long long t) {
+    int base = 0, lon = m;
+    while (lon > 1) {
+        int mitad = lon / 2;
+        base = valores[base + mitad - 1] <= t ? base + mitad : base;
+        lon -= mitad;
+    }
+    return base + (lon == 1 && valores[base] <= t);
+}
+
+/*
+ * Conjunto de actividades ya seleccionadas
+ *
+ * Las seleccionadas son compatibles entre sí, así que ordenadas por inicio también quedan
+ * ordenadas por fin. Una candidata [s, e) choca con alguna de ellas si y solo si la primera
+ * seleccionada que termina después de s empieza antes de e. Basta entonces con un conjunto
+ * ordenado de tiempos de fin que responda "siguiente fin mayor que s":
+ * - Los fines posibles se conocen de antemano (los de todas las actividades), así que cada fin
+ *   se representa por su posición entre los fines distintos ordenados. conjuntoIniciar calcula
+ *   una sola vez, para cada actividad del orden, la posición de su fin (posFin) y la del primer
+ *   fin mayor que su inicio (posSucesor): ordena pares (tiempo, actividad) por fin y por inicio
+ *   con Radix sort y los recorre juntos. La selección ya no busca nada en el arreglo de fines.
+ * - Las posiciones ocupadas se marcan en un mapa de bits de varios niveles: cada bit de un
+ *   nivel dice si la palabra de 64 bits correspondiente del nivel de abajo tiene algún bit.
+ *   El sucesor sube hasta encontrar una palabra con bits a la derecha y baja con __builtin_ctzll,
+ *   así que toca a lo más dos palabras por nivel (cinco niveles alcanzan para 2^30 fines).
+ * - inicioMinimo guarda, por cada fin ocupado, el menor inicio seleccionado con ese fin (puede
+ *   haber varios si hay actividades de duración cero).
+ */
+#define MAX_NIVELES_CONJUNTO 6
+
+typedef struct {
+    long long *inicioMinimo;   // Por posición de fin: menor inicio seleccionado, o LLONG_MAX si está libre
+    int *posFin;               // Por actividad del orden: posición de su fin
+    int *posSucesor;           // Por actividad del orden: posición del primer fin mayor que su inicio
+    int m;               // Fines distintos
+    unsigned long long *bits[MAX_NIVELES_CONJUNTO];   // bits[0]: posiciones ocupadas
+    int palabras[MAX_NIVELES_CONJUNTO];               // Palabras de cada nivel
+    int niveles;         // El último nivel tiene una sola palabra
+} ConjuntoSeleccionadas;
+
+// Un tiempo (inicio o fin, con el bit de signo invertido) y la actividad del orden a la que pertenece
+typedef struct {
+    unsigned long long clave;
+    int actividad;
+} TiempoActividad;
+
+static inline unsigned long long claveTiempo(long long t) {
+    return (unsigned long long)t ^ (1ULL << 63);
+}
+
+/*
+ * Radix sort LSD de los pares por clave, en pasadas de 8 bits con un auxiliar de n pares. Las
+ * pasadas en las que todas las claves comparten el byte se omiten: con tiempos menores que 2^24
+ * solo se hacen tres. Devuelve 0 si falta memoria.
+ */
+int ordenarTiempos(TiempoActividad *pares, int n) {
+    TiempoActividad *auxiliar = malloc((size_t)(n > 0 ? n : 1) * sizeof(TiempoActividad));
+    size_t (*conteo)[256] = calloc(8, sizeof(*conteo));
+    if (auxiliar == NULL || conteo == NULL) {
+        free(auxiliar);
+        free(conteo);
+        return 0;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int b = 0; b < 8; b++) {
+            conteo[b][(pares[i].clave >> (8 * b)) & 0xFF]++;
+        }
+    }
+    TiempoActividad *origen = pares, *destino = auxiliar;
+    for (int b = 0; b < 8 && n > 0; b++) {
+        int corrimiento = 8 * b;
+        if (conteo[b][(origen[0].clave >> corrimiento) & 0xFF] == (size_t)n) {
+            continue;
+        }
+        size_t posicion = 0;
+        for (int d = 0; d < 256; d++) {
+            size_t cuantos = conteo[b][d];
+            conteo[b][d] = posicion;
+            posicion += cuantos;
+        }
+        for (int i = 0; i < n; i++) {
+            destino[conteo[b][(origen[i].clave >> corrimiento) & 0xFF]++] = origen[i];
+        }
+        TiempoActividad *temp = origen;
+        origen = destino;
+        destino = temp;
+    }
+    if (origen != pares) {
+        memcpy(pares, origen, (size_t)n * sizeof(TiempoActividad));
+    }
+    free(auxiliar);
+    free(conteo);
+    return 1;
+}
+
+void conjuntoLiberar(ConjuntoSeleccionadas *c) {
+    free(c->inicioMinimo);
+    free(c->posFin);
+    free(c->posSucesor);
+    for (int l = 0; l < c->niveles; l++) {
+        free(c->bits[l]);
+    }
+}
+
+// Prepara el conjunto vacío para las actividades en el orden dado. Devuelve 0 si falta memoria.
+int conjuntoIniciar(ConjuntoSeleccionadas *c, const Actividad orden[], int n) {
+    size_t lugares = (size_t)(n > 0 ? n : 1);
+    c->inicioMinimo = malloc(lugares * sizeof(long long));
+    c->posFin = malloc(lugares * sizeof(int));
+    c->posSucesor = malloc(lugares * sizeof(int));
+    c->m = 0;
+    c->niveles = 0;
+    unsigned long long *fines = malloc(lugares * sizeof(unsigned long long));
+    TiempoActividad *tiempos = malloc(lugares * sizeof(TiempoActividad));
+    if (c->inicioMinimo == NULL || c->posFin == NULL || c->posSucesor == NULL || fines == NULL ||
+        tiempos == NULL) {
+        free(fines);
+        free(tiempos);
+        return 0;
+    }
+
+    // Fines distintos en orden (como claves), y la posición del fin de cada actividad
+    for (int i = 0; i < n; i++) {
+        tiempos[i].clave = claveTiempo(orden[i].fin);
+        tiempos[i].actividad = i;
+    }
+    int ordenados = ordenarTiempos(tiempos, n);
+    for (int i = 0; ordenados && i < n; i++) {
+        if (c->m == 0 || fines[c->m - 1] != tiempos[i].clave) {
+            fines[c->m++] = tiempos[i].clave;
+        }
+        c->posFin[tiempos[i].actividad] = c->m - 1;
+    }
+    // Con los inicios en orden, el primer fin mayor que cada uno solo avanza
+    for (int i = 0; ordenados && i < n; i++) {
+        tiempos[i].clave = claveTiempo(orden[i].inicio);
+        tiempos[i].actividad = i;
+    }
+    ordenados = ordenados && ordenarTiempos(tiempos, n);
+    int q = 0;
+    for (int i = 0; ordenados && i < n; i++) {
+        while (q < c->m && fines[q] <= tiempos[i].clave) {
+            q++;
+        }
+        c->posSucesor[tiempos[i].actividad] = q;
+    }
+    free(fines);
+    free(tiempos);
+    if (!ordenados) {
+        return 0;
+    }
+    for (int i = 0; i < c->m; i++) {
+        c->inicioMinimo[i] = LLONG_MAX;
+    }
+
+    long long elementos = c->m;
+    do {
+        int palabras = (int)((elementos + 63) / 64);
+        c->bits[c->niveles] = calloc((size_t)(palabras > 0 ? palabras : 1), sizeof(unsigned long long));
+        c->palabras[c->niveles] = palabras;
+        if (c->bits[c->niveles++] == NULL) {
+            return 0;
+        }
+        elementos = palabras;
+    } while (elementos > 1 && c->niveles < MAX_NIVELES_CONJUNTO);
+    return 1;
+}
+
+// Primera posición ocupada en [p, m), o -1 si no hay
+int conjuntoSucesor(const ConjuntoSeleccionadas *c, int p) {
+    int l = 0;
+    // Subir hasta un nivel donde la palabra de p tenga un bit en p o a su derecha
+    for (;;) {
+        int w = p >> 6;
+        if (w >= c->palabras[l]) {
+            return -1;
+        }
+        unsigned long long resto = c->bits[l][w] & (~0ULL << (p & 63));
+        if (resto != 0) {
+            p = (w << 6) | __builtin_ctzll(resto);
+            break;
+        }
+        if (++l == c->niveles) {
+            return -1;
+        }
+        p = w + 1;
+    }
+    // Bajar tomando siempre el primer bit encendido
+    while (l > 0) {
+        l--;
+        p = (p << 6) | __builtin_ctzll(c->bits[l][p]);
+    }
+    return p;
+}
+
+// Devuelve 1 si la actividad i del orden, que termina en fin, no se traslapa con ninguna del conjunto
+int conjuntoAdmite(const ConjuntoSeleccionadas *c, int i, long long fin) {
+    int q = conjuntoSucesor(c, c->posSucesor[i]);
+    return q < 0 || c->inicioMinimo[q] >= fin;
+}
+
+// Agrega la actividad i del orden, que empieza en inicio
+void conjuntoAgregar(ConjuntoSeleccionadas *c, int i, long long inicio) {
+    int p = c->posFin[i];
+    if (inicio < c->inicioMinimo[p]) {
+        c->inicioMinimo[p] = inicio;
+    }
+    for (int l = 0; l < c->niveles; l++) {
+        c->bits[l][p >> 6] |= 1ULL << (p & 63);
+        p >>= 6;
+    }
+}
+
+/*
+ * Selección ávida sobre actividades ya ordenadas según el criterio
+ *
+ * Con los criterios de inicio y de finalización (y los desempates de sus comparadores), las
+ * seleccionadas van quedando ordenadas y la última es la que termina más tarde: una candidata
+ * es compatible con todas si y solo si empieza cuando o después de que esa termina. Basta con
+ * recordar el último fin, O(n). Con el criterio de duración una candidata puede caer entre dos
+ * seleccionadas, así que se consulta "conjunto", que ordenarPorCriterio preparó sobre el mismo
+ * orden: O(log m / 6) palabras por candidata. En ambos casos el resultado es el mismo que revisar
+ * la candidata contra todas las seleccionadas.
+ *
+ * Guarda las seleccionadas en "seleccionadas" (n lugares) en el orden en que se aceptaron y
+ * devuelve cuántas son. Si imprimir es distinto de 0 escribe una línea por actividad considerada.
+ */
+int seleccionarOrdenadas(const Actividad orden[], int n, int criterio, ConjuntoSeleccionadas *conjunto,
+                         int imprimir, Actividad seleccionadas[]) {
+    int numSeleccionadas = 0;
+
+    if (criterio != 3) {
+        int hayUltima = 0;
+        long long ultimoFin = 0;
+        for (int i = 0; i < n; i++) {
+            int esCompatible = !hayUltima || ultimoFin <= orden[i].inicio;
+            if (esCompatible) {
+                seleccionadas[numSeleccionadas++] = orden[i];
+                ultimoFin = orden[i].fin;
+                hayUltima = 1;
+            }
+            if (imprimir) {
+                imprimirDecision(orden[i], esCompatible);
+            }
+        }
+        return numSeleccionadas;
+    }
+
+    for (int i = 0; i < n; i++) {
+        int esCompatible = conjuntoAdmite(conjunto, i, orden[i].fin);
+        if (esCompatible) {
+            seleccionadas[numSeleccionadas++] = orden[i];
+            conjuntoAgregar(conjunto, i, orden[i].inicio);
+        }
+        if (imprimir) {
+            imprimirDecision(orden[i], esCompatible);
+        }
+    }
+    return numSeleccionadas;
+}
+
+// Ordena una copia de las actividades según el criterio (1: inicio, 2: fin, 3: duración). Con el
+// de duración también inicia "conjunto" sobre el nuevo orden; quien llama lo libera con
+// conjuntoLiberar. Devuelve 0 si falta memoria.
+int ordenarPorCriterio(Actividad copia[], int n, int criterio, ConjuntoSeleccionadas *conjunto) {
     switch(criterio) {
         case 1:
-            printf("\n Criterio de Tiempo de Inicio\n");
             qsort(copia, n, sizeof(Actividad), compararPorInicio);
             break;
         case 2:
-            printf("\n Criterio de Tiempo de FInalizacion\n");
             qsort(copia, n, sizeof(Actividad), compararPorFin);
             break;
         case 3:
-            printf("\n Criterio de Tiempo de Duracion\n");
             qsort(copia, n, sizeof(Actividad), compararPorDuracion);
-            break;
+            return conjuntoIniciar(conjunto, copia, n);
     }
+    return 1;
+}
+
+// Función que implementa el algoritmo ávido para seleccionar actividades e imprime el proceso
+void seleccionarActividades(Actividad actividades[], int n, int criterio) {
+    // Crear una copia del arreglo para no modificar el original
+    Actividad *copia = (Actividad *)malloc(n * sizeof(Actividad));
+    memcpy(copia, actividades, n * sizeof(Actividad));
+    
+    // Ordenar según el criterio seleccionado
+    printf("\n %s\n", NOMBRES_CRITERIO[criterio]);
+    ConjuntoSeleccionadas conjunto = {0};
+    int preparado = ordenarPorCriterio(copia, n, criterio, &conjunto);
     
     // Mostrar el orden después de ordenar
     printf("Orden de consideracion: ");
     for(int i = 0; i < n; i++) {
-        printf("%c ", copia[i].nombre);
+        printf("%lld ", copia[i].id);
     }
     printf("\n\n");
     
     // Arreglo para guardar las actividades seleccionadas
     Actividad *seleccionadas = (Actividad *)malloc(n * sizeof(Actividad));
     int numSeleccionadas = 0;
-    
-    // Algoritmo ávido: recorrer las actividades ordenadas
-    for(int i = 0; i < n; i++) {
-        int esCompatible = 1; // Bandera para verificar compatibilidad
-        
-        // Verificar si la actividad actual es compatible con todas las ya seleccionadas
-        for(int j = 0; j < numSeleccionadas; j++) {
-            if(!sonCompatibles(copia[i], seleccionadas[j])) {
-                esCompatible = 0;
-                break;
-            }
-        }
-        
-        // Si es compatible, agregarla a la solución
-        if(esCompatible) {
-            seleccionadas[numSeleccionadas] = copia[i];
-            numSeleccionadas++;
-            printf("Seleccionada: %c [%d, %d] - Duracion: %d\n", 
-                   copia[i].nombre, copia[i].inicio, copia[i].fin, 
-                   calcularDuracion(copia[i]));
-        } else {
-            printf("Rechazada:    %c [%d, %d] - Se traslapa con otra actividad\n", 
-                   copia[i].nombre, copia[i].inicio, copia[i].fin);
-        }
+    if (preparado) {
+        numSeleccionadas = seleccionarOrdenadas(copia, n, criterio, &conjunto, 1, seleccionadas);
+    } else {
+        printf("Error: no hay memoria para seleccionar\n");
     }
+    conjuntoLiberar(&conjunto);
     
     // Mostrar el resumen de la solución
     printf("Total de actividades seleccionadas: %d\n", numSeleccionadas);
     printf("Secuencia: ");
     for(int i = 0; i < numSeleccionadas; i++) {
-        printf("%c ", seleccionadas[i].nombre);
+        printf("%lld ", seleccionadas[i].id);
     }
     printf("\n");
     
@@ -114,32 +412,375 @@ void seleccionarActividades(Actividad actividades[], int n, int criterio) {
     free(seleccionadas);
 }
 
+/*
+ * Selección ponderada: actividades compatibles con el mayor peso total
+ *
+ * Recibe las actividades ordenadas con compararPorFin. Si mejor[j] es el mayor peso que se logra
+ * con las primeras j, la actividad j-1 se toma o no:
+ *     mejor[j] = max(mejor[j - 1], peso[j - 1] + mejor[p(j - 1)])
+ * donde p(i) cuenta las actividades que terminan cuando o antes de que empiece la i (sin contarla
+ * a ella ni a las posteriores). Como los fines están ordenados, p(i) es una búsqueda binaria sobre
+ * ellos: O(n log n) en total. El desempate de compararPorFin garantiza que toda actividad
+ * compatible con la i y anterior a ella en el orden quede dentro de las p(i) primeras.
+ *
+ * La reconstrucción recorre mejor[] de atrás hacia adelante: la actividad j-1 se tomó si
+ * mejor[j] != mejor[j - 1], y entonces se salta a p(j - 1). No se guarda p() para ahorrar memoria;
+ * se vuelve a calcular solo para las actividades elegidas. Los pesos negativos nunca se toman.
+ *
+ * Guarda las elegidas en "elegidas" (n lugares) en orden de inicio, su peso total en *pesoTotal
+ * y devuelve cuántas son, o -1 si falta memoria.
+ */
+int seleccionarPonderadas(const Actividad orden[], int n, Actividad elegidas[], long long *pesoTotal) {
+    long long *fines = malloc((size_t)(n > 0 ? n : 1) * sizeof(long long));
+    long long *mejor = malloc(((size_t)n + 1) * sizeof(long long));
+    if (fines == NULL || mejor == NULL) {
+        free(fines);
+        free(mejor);
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        fines[i] = orden[i].fin;
+    }
+
+    mejor[0] = 0;
+    for (int i = 0; i < n; i++) {
+        int p = primerMayorQue(fines, n, orden[i].inicio);
+        if (p > i) {
+            p = i;   // Actividad de duración cero: ella y las que empatan después no son predecesoras
+        }
+        long long tomando = orden[i].peso + mejor[p];
+        mejor[i + 1] = tomando > mejor[i] ? tomando : mejor[i];
+    }
+    *pesoTotal = mejor[n];
+
+    // Reconstruir desde el final; las elegidas salen al revés y se voltean al terminar
+    int k = 0;
+    for (int j = n; j > 0; ) {
+        if (mejor[j] == mejor[j - 1]) {
+            j--;
+            continue;
+        }
+        elegidas[k++] = orden[j - 1];
+        int p = primerMayorQue(fines, n, orden[j - 1].inicio);
+        j = p < j - 1 ? p : j - 1;
+    }
+    for (int i = 0; i < k / 2; i++) {
+        Actividad temp = elegidas[i];
+        elegidas[i] = elegidas[k - 1 - i];
+        elegidas[k - 1 - i] = temp;
+    }
+
+    free(fines);
+    free(mejor);
+    return k;
+}
+
+// Imprime la selección ponderada del ejemplo, como seleccionarActividades
+void seleccionarPonderadasEjemplo(Actividad actividades[], int n) {
+    Actividad *copia = (Actividad *)malloc(n * sizeof(Actividad));
+    Actividad *elegidas = (Actividad *)malloc(n * sizeof(Actividad));
+    memcpy(copia, actividades, n * sizeof(Actividad));
+    qsort(copia, n, sizeof(Actividad), compararPorFin);
+
+    printf("\n Seleccion Ponderada (mayor peso total)\n");
+    long long peso = 0;
+    int k = seleccionarPonderadas(copia, n, elegidas, &peso);
+    if (k < 0) {
+        printf("Error: no hay memoria para seleccionar\n");
+        k = 0;
+    }
+    for (int i = 0; i < k; i++) {
+        printf("Seleccionada: %lld [%lld, %lld] - Peso: %lld\n",
+               elegidas[i].id, elegidas[i].inicio, elegidas[i].fin, elegidas[i].peso);
+    }
+    printf("Total de actividades seleccionadas: %d\n", k);
+    printf("Peso total: %lld\n", peso);
+
+    free(copia);
+    free(elegidas);
+}
+
 // Función para mostrar todas las actividades
 void mostrarActividades(Actividad actividades[], int n) {
     printf("Actividades disponibles:\n");
-    printf("Nombre | Inicio | Fin | Duracion\n");
-    printf("-------|--------|-----|----------\n");
+    printf("  Id   | Inicio | Fin | Duracion | Peso\n");
+    printf("-------|--------|-----|----------|------\n");
     for(int i = 0; i < n; i++) {
-        printf("   %c   |   %2d   | %2d  |    %d\n", 
-               actividades[i].nombre, 
+        printf("  %2lld   |   %2lld   | %2lld  |    %lld     |  %2lld\n", 
+               actividades[i].id, 
                actividades[i].inicio, 
                actividades[i].fin,
-               calcularDuracion(actividades[i]));
+               calcularDuracion(actividades[i]),
+               actividades[i].peso);
     }
     printf("\n");
 }
 
-int main() {
+// Duración y peso máximos de las actividades generadas
+#define DURACION_MAXIMA 100
+#define PESO_MAXIMO 100
+
+// Llena n actividades con ids 1..n, inicio al azar en [0, 8n), duración al azar en
+// [1, DURACION_MAXIMA] y peso al azar en [1, PESO_MAXIMO]
+void generarActividades(Actividad actividades[], int n, unsigned long long semilla) {
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    long long horizonte = 8LL * n;
+    if (horizonte > UINT32_MAX) {
+        horizonte = UINT32_MAX;
+    }
+    for (int i = 0; i < n; i++) {
+        actividades[i].id = i + 1;
+        actividades[i].inicio = generadorRango(&g, (uint32_t)horizonte);
+        actividades[i].fin = actividades[i].inicio + 1 + generadorRango(&g, DURACION_MAXIMA);
+        actividades[i].peso = 1 + generadorRango(&g, PESO_MAXIMO);
+    }
+}
+
+/*
+ * Lee actividades con cargarIntervalos (CSV "id,inicio,fin[,peso]" o binario .ivl). Si horaTarde
+ * es positivo los tiempos se convierten de horas de reloj a minutos. Devuelve el arreglo (NULL si
+ * hubo un error, que ya se imprimió) y guarda en *n cuántas actividades leyó.
+ */
+Actividad *cargarActividades(const char *ruta, int horaTarde, int *n) {
+    Intervalos iv;
+    if (!cargarIntervalos(ruta, &iv)) {
+        printf("Error: %s\n", iv.error);
+        return NULL;
+    }
+    if (horaTarde > 0) {
+        intervalosNormalizarReloj(&iv, horaTarde);
+    }
+    long long invalido = intervaloInvalido(&iv);
+    if (invalido >= 0) {
+        printf("Error: la actividad %lld termina antes de empezar\n", (long long)iv.id[invalido]);
+        intervalosLiberar(&iv);
+        return NULL;
+    }
+    if (iv.n > INT_MAX / 8) {
+        printf("Error: %s tiene demasiadas actividades (%lld)\n", ruta, iv.n);
+        intervalosLiberar(&iv);
+        return NULL;
+    }
+    Actividad *actividades = malloc((size_t)(iv.n > 0 ? iv.n : 1) * sizeof(Actividad));
+    if (actividades == NULL) {
+        printf("Error: no hay memoria para %lld actividades\n", iv.n);
+        intervalosLiberar(&iv);
+        return NULL;
+    }
+    for (long long i = 0; i < iv.n; i++) {
+        actividades[i].id = iv.id[i];
+        actividades[i].inicio = iv.inicio[i];
+        actividades[i].fin = iv.fin[i];
+        actividades[i].peso = iv.peso[i];
+    }
+    *n = (int)iv.n;
+    intervalosLiberar(&iv);
+    return actividades;
+}
+
+// Guarda las actividades en un archivo binario .ivl que después se puede pasar a --entrada
+int guardarActividades(const char *ruta, const Actividad actividades[], int n) {
+    Intervalos iv;
+    intervalosIniciar(&iv);
+    if (!intervalosReservar(&iv, n > 0 ? n : 1)) {
+        printf("Error: %s\n", iv.error);
+        intervalosLiberar(&iv);
+        return 0;
+    }
+    for (int i = 0; i < n; i++) {
+        intervalosAgregar(&iv, actividades[i].id, actividades[i].inicio, actividades[i].fin, actividades[i].peso);
+    }
+    iv.conPeso = 1;
+    int exito = guardarIntervalosBinario(ruta, &iv);
+    if (!exito) {
+        printf("Error: no se pudo escribir %s\n", ruta);
+    }
+    intervalosLiberar(&iv);
+    return exito;
+}
+
+// Ordena por inicio y, a igual inicio, por fin (las de duración cero primero)
+int compararPorInicioYFin(const void *a, const void *b) {
+    const Actividad *act1 = (const Actividad *)a;
+    const Actividad *act2 = (const Actividad *)b;
+    int c = compararEnteros(act1->inicio, act2->inicio);
+    return c != 0 ? c : compararEnteros(act1->fin, act2->fin);
+}
+
+// Devuelve 1 si ningún par de seleccionadas se traslapa. Reordena el arreglo.
+int verificarSeleccion(Actividad seleccionadas[], int k) {
+    qsort(seleccionadas, (size_t)k, sizeof(Actividad), compararPorInicioYFin);
+    for (int i = 1; i < k; i++) {
+        if (!sonCompatibles(seleccionadas[i - 1], seleccionadas[i])) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Mide ordenamiento y selección sobre n actividades, para uno o los tres criterios
+int benchmarkSeleccion(const Actividad actividades[], int n, int criterio, int imprimir) {
+    Actividad *copia = malloc((size_t)(n > 0 ? n : 1) * sizeof(Actividad));
+    Actividad *seleccionadas = malloc((size_t)(n > 0 ? n : 1) * sizeof(Actividad));
+    if (copia == NULL || seleccionadas == NULL) {
+        printf("Error: no hay memoria para %d actividades\n", n);
+        free(copia);
+        free(seleccionadas);
+        return 1;
+    }
+
+    int resultado = 0;
+    for (int c = 1; c <= 3; c++) {
+        if (criterio != 0 && c != criterio) {
+            continue;
+        }
+        memcpy(copia, actividades, (size_t)n * sizeof(Actividad));
+        ConjuntoSeleccionadas conjunto = {0};
+        double inicio = tiempoMonotonico();
+        int preparado = ordenarPorCriterio(copia, n, c, &conjunto);
+        double ordenar = tiempoMonotonico() - inicio;
+        if (!preparado) {
+            printf("Error: no hay memoria para seleccionar\n");
+            conjuntoLiberar(&conjunto);
+            resultado = 1;
+            break;
+        }
+        if (imprimir) {
+            printf("\n %s\n", NOMBRES_CRITERIO[c]);
+        }
+        inicio = tiempoMonotonico();
+        int k = seleccionarOrdenadas(copia, n, c, &conjunto, imprimir, seleccionadas);
+        double seleccionar = tiempoMonotonico() - inicio;
+        conjuntoLiberar(&conjunto);
+        int valida = verificarSeleccion(seleccionadas, k);
+        printf("%-36s seleccionadas: %9d   ordenar: %.6f s   seleccionar: %.6f s   %s\n",
+               NOMBRES_CRITERIO[c], k, ordenar, seleccionar, valida ? "sin traslapes" : "TRASLAPE");
+        if (!valida) {
+            resultado = 1;
+        }
+    }
+
+    free(copia);
+    free(seleccionadas);
+    return resultado;
+}
+
+// Resuelve la selección ponderada de n actividades y mide el ordenamiento y la programación dinámica
+int ejecutarPonderado(Actividad actividades[], int n, int imprimir) {
+    Actividad *elegidas = malloc((size_t)(n > 0 ? n : 1) * sizeof(Actividad));
+    if (elegidas == NULL) {
+        printf("Error: no hay memoria para %d actividades\n", n);
+        return 1;
+    }
+    double inicio = tiempoMonotonico();
+    qsort(actividades, (size_t)n, sizeof(Actividad), compararPorFin);
+    double ordenar = tiempoMonotonico() - inicio;
+    long long peso = 0;
+    inicio = tiempoMonotonico();
+    int k = seleccionarPonderadas(actividades, n, elegidas, &peso);
+    double seleccionar = tiempoMonotonico() - inicio;
+    if (k < 0) {
+        printf("Error: no hay memoria para seleccionar\n");
+        free(elegidas);
+        return 1;
+    }
+    if (imprimir) {
+        for (int i = 0; i < k; i++) {
+            printf("Seleccionada: %lld [%lld, %lld] - Peso: %lld\n",
+                   elegidas[i].id, elegidas[i].inicio, elegidas[i].fin, elegidas[i].peso);
+        }
+    }
+    long long suma = 0;
+    for (int i = 0; i < k; i++) {
+        suma += elegidas[i].peso;
+    }
+    int valida = suma == peso && verificarSeleccion(elegidas, k);
+    printf("Seleccion ponderada: %d de %d actividades   peso total: %lld   ordenar: %.6f s   "
+           "programacion dinamica: %.6f s   %s\n",
+           k, n, peso, ordenar, seleccionar, valida ? "sin traslapes" : "INVALIDA");
+    free(elegidas);
+    return valida ? 0 : 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        long long n = -1;
+        int criterio = 0, imprimir = 0, ponderado = 0, horaTarde = 0;
+        const char *rutaEntrada = NULL, *rutaGuardar = NULL;
+        unsigned long long semilla = (unsigned long long)time(NULL);
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--generar") == 0 && i + 1 < argc) {
+                n = atoll(argv[++i]);
+            } else if (strcmp(argv[i], "--criterio") == 0 && i + 1 < argc) {
+                criterio = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--semilla") == 0 && i + 1 < argc) {
+                semilla = strtoull(argv[++i], NULL, 10);
+            } else if (strcmp(argv[i], "--imprimir") == 0) {
+                imprimir = 1;
+            } else if (strcmp(argv[i], "--ponderado") == 0) {
+                ponderado = 1;
+            } else if (strcmp(argv[i], "--entrada") == 0 && i + 1 < argc) {
+                rutaEntrada = argv[++i];
+            } else if (strcmp(argv[i], "--reloj") == 0 && i + 1 < argc) {
+                horaTarde = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--guardar") == 0 && i + 1 < argc) {
+                rutaGuardar = argv[++i];
+            } else {
+                printf("Opcion no reconocida: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        if (criterio < 0 || criterio > 3) {
+            printf("Error: --criterio debe estar entre 1 y 3\n");
+            return 1;
+        }
+
+        Actividad *actividades;
+        int total = 0;
+        if (rutaEntrada != NULL) {
+            actividades = cargarActividades(rutaEntrada, horaTarde, &total);
+            if (actividades == NULL) {
+                return 1;
+            }
+            printf("%d actividades leidas de %s\n", total, rutaEntrada);
+        } else {
+            if (n <= 0 || n > INT_MAX / 8) {
+                printf("Error: se necesita --entrada archivo o --generar n con 0 < n < 2^28\n");
+                return 1;
+            }
+            total = (int)n;
+            actividades = malloc((size_t)total * sizeof(Actividad));
+            if (actividades == NULL) {
+                printf("Error: no hay memoria para %d actividades\n", total);
+                return 1;
+            }
+            generarActividades(actividades, total, semilla);
+            printf("%d actividades generadas (semilla %llu)\n", total, semilla);
+        }
+
+        int resultado = 0;
+        if (rutaGuardar != NULL && !guardarActividades(rutaGuardar, actividades, total)) {
+            resultado = 1;
+        } else if (ponderado) {
+            resultado = ejecutarPonderado(actividades, total, imprimir);
+        } else {
+            resultado = benchmarkSeleccion(actividades, total, criterio, imprimir);
+        }
+        free(actividades);
+        return resultado;
+    }
+
     // Datos proporcionados
     Actividad actividades[] = {
-        {'a', 0, 6},
-        {'b', 1, 4},
-        {'c', 3, 5},
-        {'d', 3, 8},
-        {'e', 4, 7},
-        {'f', 5, 9},
-        {'g', 6, 10},
-        {'h', 8, 11}
+        {1, 0, 6, 3},
+        {2, 1, 4, 2},
+        {3, 3, 5, 4},
+        {4, 3, 8, 7},
+        {5, 4, 7, 1},
+        {6, 5, 9, 5},
+        {7, 6, 10, 2},
+        {8, 8, 11, 4}
     };
     
     int n = sizeof(actividades) / sizeof(actividades[0]);
@@ -154,6 +795,8 @@ int main() {
     seleccionarActividades(actividades, n, 2);
     printf("\n");
     seleccionarActividades(actividades, n, 3);
+    printf("\n");
+    seleccionarPonderadasEjemplo(actividades, n);
     
     return 0;
-}
\ No newline at end of file
+}
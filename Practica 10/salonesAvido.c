@@ -1,118 +1,396 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include "../Comun/intervalos.h"
+#include "../Comun/medicion.h"
+
+/**
+ * Compilación: gcc salonesAvido.c -o salonesAvido
+ * Ejecución:   ./salonesAvido                          Ejemplo de la práctica
+ *              ./salonesAvido --entrada archivo [--reloj h] [--imprimir] [--barrido]
+ *                  Lee las clases de un archivo (ver Comun/intervalos.h: CSV "id,inicio,fin" o
+ *                  binario .ivl) y mide la asignación a salones. Con --reloj h los tiempos son horas
+ *                  de reloj (930 = 9:30) y las menores que h son de la tarde. Con --imprimir
+ *                  también escribe cada paso y las clases de cada salón. Con --barrido solo calcula
+ *                  el número mínimo de salones, sin asignarlos.
+ */
 
 // Estructura para representar una clase con su tiempo de inicio y fin
 typedef struct {
-    int inicio;
-    int fin;
-    char nombre;  // Identificador de la clase (a, b, c, etc.)
+    long long inicio;
+    long long fin;
+    long long id;  // Identificador de la clase
 } Clase;
 
 // Estructura para representar un salón que tiene un registro de cuándo termina su última clase
 typedef struct {
-    int fin_ultima_clase;  // Hora en que termina la última clase asignada
-    int numero_salon;      // Número identificador del salón
+    long long fin_ultima_clase;  // Hora en que termina la última clase asignada
+    int numero_salon;            // Número identificador del salón
 } Salon;
 
+// 1 si los tiempos son minutos desde la medianoche y se imprimen como hh:mm
+static int tiemposDeReloj = 0;
+
+// Escribe un tiempo en el formato de los datos (hh:mm para horas de reloj)
+void imprimirTiempo(long long t) {
+    if (tiemposDeReloj) {
+        printf("%lld:%02lld", t / 60, t % 60);
+    } else {
+        printf("%lld", t);
+    }
+}
+
 // Función para comparar dos clases por su tiempo de inicio (para ordenar)
 // Esta función la usaremos con qsort
 int compararClases(const void *a, const void *b) {
     Clase *claseA = (Clase *)a;
     Clase *claseB = (Clase *)b;
     
-    // Retornamos la diferencia de los tiempos de inicio
+    // Comparamos en lugar de restar: la resta de tiempos de 64 bits no cabe en un int
     // Si es negativo, claseA va primero; si es positivo, claseB va primero
-    return claseA->inicio - claseB->inicio;
+    return (claseA->inicio > claseB->inicio) - (claseA->inicio < claseB->inicio);
 }
 
-int main() {
-    // Definimos las clases según el diagrama
-    // Cada clase tiene: tiempo de inicio, tiempo de fin, y un nombre identificador
-    Clase clases[] = {
-        {9, 10, 'a'},      // Clase 'a' de 9:00 a 10:00
-        {930, 1030, 'b'},  // Clase 'b' de 9:30 a 10:30
-        {10, 11, 'c'},     // Clase 'c' de 10:00 a 11:00
-        {11, 1230, 'd'},   // Clase 'd' de 11:00 a 12:30
-        {12, 130, 'e'},    // Clase 'e' de 12:00 a 1:30
-        {1230, 230, 'f'},  // Clase 'f' de 12:30 a 2:30
-        {130, 230, 'g'},   // Clase 'g' de 1:30 a 2:30
-        {230, 4, 'h'},     // Clase 'h' de 2:30 a 4:00
-        {3, 330, 'i'},     // Clase 'i' de 3:00 a 3:30
-        {330, 430, 'j'}    // Clase 'j' de 3:30 a 4:30
-    };
-    
-    int num_clases = sizeof(clases) / sizeof(clases[0]);
-    
-    printf("Problema: Asignar %d clases al mínimo número de salones\n\n", num_clases);
-    
-    // PASO 1: Ordenar las clases por tiempo de inicio
-    // Esto es crucial porque procesamos las clases en orden cronológico
-    printf("PASO 1: Ordenando clases por tiempo de inicio...\n");
-    qsort(clases, num_clases, sizeof(Clase), compararClases);
-    
-    printf("Clases ordenadas:\n");
-    for (int i = 0; i < num_clases; i++) {
-        printf("  Clase '%c': inicio=%d, fin=%d\n", 
-               clases[i].nombre, clases[i].inicio, clases[i].fin);
+/*
+ * Montículo de salones
+ *
+ * Los salones abiertos se guardan en un montículo mínimo según la hora en que termina su
+ * última clase (a igual hora, el de menor número). La raíz es el salón que se desocupa primero:
+ * si ni ése está libre cuando empieza una clase, ninguno lo está. Así cada clase cuesta
+ * O(log k) con k salones abiertos, en lugar de revisar los k salones.
+ */
+int salonAntes(Salon a, Salon b) {
+    return a.fin_ultima_clase < b.fin_ultima_clase ||
+           (a.fin_ultima_clase == b.fin_ultima_clase && a.numero_salon < b.numero_salon);
+}
+
+// Baja el salón de la posición i hasta que sus hijos terminen después que él
+void hundirSalon(Salon monticulo[], int k, int i) {
+    Salon salon = monticulo[i];
+    for (;;) {
+        int hijo = 2 * i + 1;
+        if (hijo >= k) {
+            break;
+        }
+        if (hijo + 1 < k && salonAntes(monticulo[hijo + 1], monticulo[hijo])) {
+            hijo++;
+        }
+        if (!salonAntes(monticulo[hijo], salon)) {
+            break;
+        }
+        monticulo[i] = monticulo[hijo];
+        i = hijo;
+    }
+    monticulo[i] = salon;
+}
+
+// Sube el salón de la posición i hasta que su padre termine antes que él
+void subirSalon(Salon monticulo[], int i) {
+    Salon salon = monticulo[i];
+    while (i > 0 && salonAntes(salon, monticulo[(i - 1) / 2])) {
+        monticulo[i] = monticulo[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    monticulo[i] = salon;
+}
+
+/*
+ * Asigna las clases (ya ordenadas por inicio) al mínimo número de salones y devuelve cuántos
+ * se usaron, o -1 si falta memoria. salonDeClase[i] recibe el número de salón (desde 1) de
+ * clases[i]. Si imprimir es distinto de 0 explica cada paso.
+ */
+int asignarSalones(const Clase clases[], int num_clases, int imprimir, int salonDeClase[]) {
+    // PASO 2: Preparar el montículo de salones
+    // En el peor caso necesitamos un salón por clase
+    Salon *salones = (Salon *)malloc((num_clases > 0 ? num_clases : 1) * sizeof(Salon));
+    if (salones == NULL) {
+        return -1;
     }
-    printf("\n");
-    
-    // PASO 2: Preparar la estructura para rastrear los salones
-    // Creamos un arreglo de salones. En el peor caso necesitamos un salón por clase
-    Salon *salones = (Salon *)malloc(num_clases * sizeof(Salon));
     int num_salones_usados = 0;  // Contador de cuántos salones hemos necesitado
     
     // PASO 3: Procesar cada clase una por una
-    printf("PASO 2: Asignando clases a salones...\n\n");
+    if (imprimir) {
+        printf("PASO 2: Asignando clases a salones...\n\n");
+    }
     
     for (int i = 0; i < num_clases; i++) {
         Clase clase_actual = clases[i];
         
-        printf("Procesando clase '%c' (inicio=%d, fin=%d):\n", 
-               clase_actual.nombre, clase_actual.inicio, clase_actual.fin);
-        
-        // Intentamos encontrar un salón disponible
-        // Un salón está disponible si su última clase termina antes o cuando empieza la actual
-        int salon_encontrado = -1;  // -1 significa que no hemos encontrado salón disponible
-        
-        // Revisamos todos los salones que ya estamos usando
-        for (int j = 0; j < num_salones_usados; j++) {
-            // Verificamos si este salón está libre
-            if (salones[j].fin_ultima_clase <= clase_actual.inicio) {
-                // ¡Este salón está disponible!
-                salon_encontrado = j;
-                printf("  -> Salón %d está disponible (terminó a las %d)\n", 
-                       salones[j].numero_salon, salones[j].fin_ultima_clase);
-                break;  // No necesitamos seguir buscando
-            }
+        if (imprimir) {
+            printf("Procesando clase %lld (inicio=", clase_actual.id);
+            imprimirTiempo(clase_actual.inicio);
+            printf(", fin=");
+            imprimirTiempo(clase_actual.fin);
+            printf("):\n");
         }
         
-        // Decidimos qué hacer según si encontramos un salón disponible o no
-        if (salon_encontrado != -1) {
+        // El salón que se desocupa primero está en la raíz del montículo
+        // Un salón está disponible si su última clase termina antes o cuando empieza la actual
+        if (num_salones_usados > 0 && salones[0].fin_ultima_clase <= clase_actual.inicio) {
             // CASO A: Encontramos un salón disponible, lo reutilizamos
-            // Actualizamos cuándo termina la última clase en ese salón
-            salones[salon_encontrado].fin_ultima_clase = clase_actual.fin;
-            printf("  -> Asignada al salón %d (existente)\n\n", 
-                   salones[salon_encontrado].numero_salon);
+            // Actualizamos cuándo termina la última clase en ese salón y lo reacomodamos
+            if (imprimir) {
+                printf("  -> Salón %d está disponible (terminó a las ", salones[0].numero_salon);
+                imprimirTiempo(salones[0].fin_ultima_clase);
+                printf(")\n");
+                printf("  -> Asignada al salón %d (existente)\n\n", salones[0].numero_salon);
+            }
+            salonDeClase[i] = salones[0].numero_salon;
+            salones[0].fin_ultima_clase = clase_actual.fin;
+            hundirSalon(salones, num_salones_usados, 0);
         } else {
             // CASO B: No hay salones disponibles, necesitamos uno nuevo
-            printf("  -> No hay salones disponibles\n");
-            
-            // Creamos un nuevo salón
+            // Creamos un nuevo salón al final del montículo y lo subimos a su lugar
             salones[num_salones_usados].numero_salon = num_salones_usados + 1;
             salones[num_salones_usados].fin_ultima_clase = clase_actual.fin;
+            salonDeClase[i] = num_salones_usados + 1;
             
-            printf("  -> Creando salón %d (nuevo)\n", num_salones_usados + 1);
-            printf("  -> Asignada al salón %d\n\n", num_salones_usados + 1);
+            if (imprimir) {
+                printf("  -> No hay salones disponibles\n");
+                printf("  -> Creando salón %d (nuevo)\n", num_salones_usados + 1);
+                printf("  -> Asignada al salón %d\n\n", num_salones_usados + 1);
+            }
             
+            subirSalon(salones, num_salones_usados);
             num_salones_usados++;  // Incrementamos el contador de salones
         }
     }
     
-    // PASO 4: Mostrar resultados
-    printf("Número mínimo de salones necesarios: %d\n", num_salones_usados);
     // Liberamos la memoria que reservamos dinámicamente
     free(salones);
+    return num_salones_usados;
+}
+
+/*
+ * Imprime las clases de cada salón. Agrupa con un conteo por salón (como el ordenamiento por
+ * conteo), así que cuesta O(n + salones) y conserva el orden por inicio dentro de cada salón.
+ */
+void imprimirSalones(const Clase clases[], int num_clases, const int salonDeClase[], int num_salones) {
+    int *primera = calloc((size_t)num_salones + 2, sizeof(int));
+    int *orden = malloc((size_t)(num_clases > 0 ? num_clases : 1) * sizeof(int));
+    if (primera == NULL || orden == NULL) {
+        free(primera);
+        free(orden);
+        return;
+    }
+    for (int i = 0; i < num_clases; i++) {
+        primera[salonDeClase[i] + 1]++;
+    }
+    for (int s = 1; s <= num_salones + 1; s++) {
+        primera[s] += primera[s - 1];
+    }
+    for (int i = 0; i < num_clases; i++) {
+        orden[primera[salonDeClase[i]]++] = i;
+    }
+    // primera[s] quedó en el inicio del salón s + 1, es decir, en el fin del salón s
+    for (int s = 1, desde = 0; s <= num_salones; s++) {
+        printf("  Salón %d:", s);
+        for (int j = desde; j < primera[s]; j++) {
+            const Clase *c = &clases[orden[j]];
+            printf(" %lld [", c->id);
+            imprimirTiempo(c->inicio);
+            printf(", ");
+            imprimirTiempo(c->fin);
+            printf("]");
+        }
+        printf("\n");
+        desde = primera[s];
+    }
+    free(primera);
+    free(orden);
+}
+
+int compararTiempos64(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Barrido: número mínimo de salones a partir de los inicios y los fines, cada arreglo ordenado
+ * por separado. Recorre los inicios en orden y, antes de cada uno, libera los salones de las
+ * clases que ya terminaron; el máximo de clases simultáneas es la respuesta. O(n) sin contar el
+ * ordenamiento y sin memoria adicional, pero no dice qué clase va en qué salón.
+ * Las clases son intervalos [inicio, fin): una clase de duración cero no ocupa salón, mientras que
+ * asignarSalones sí le da uno si todos están ocupados. Sin clases de duración cero ambos coinciden.
+ */
+int minimoSalonesBarrido(const int64_t inicios[], const int64_t fines[], int num_clases) {
+    int maximo = 0;
+    for (int i = 0, terminadas = 0; i < num_clases; i++) {
+        while (terminadas < num_clases && fines[terminadas] <= inicios[i]) {
+            terminadas++;
+        }
+        if (i + 1 - terminadas > maximo) {
+            maximo = i + 1 - terminadas;
+        }
+    }
+    return maximo;
+}
+
+/*
+ * Lee las clases con cargarIntervalos, las ordena y las asigna, midiendo cada parte.
+ * horaTarde > 0 indica horas de reloj (ver minutosDeReloj). Con soloBarrido no se asignan: se
+ * ordenan las columnas de inicios y fines tal como se cargaron y se cuenta con el barrido.
+ */
+int asignarDesdeArchivo(const char *ruta, int horaTarde, int imprimir, int soloBarrido) {
+    Intervalos iv;
+    double inicio = tiempoMonotonico();
+    if (!cargarIntervalos(ruta, &iv)) {
+        printf("Error: %s\n", iv.error);
+        return 1;
+    }
+    if (horaTarde > 0) {
+        intervalosNormalizarReloj(&iv, horaTarde);
+        tiemposDeReloj = 1;
+    }
+    long long invalido = intervaloInvalido(&iv);
+    if (invalido >= 0) {
+        printf("Error: la clase %lld termina antes de empezar\n", (long long)iv.id[invalido]);
+        intervalosLiberar(&iv);
+        return 1;
+    }
+    if (iv.n > 2147483647LL) {
+        printf("Error: %s tiene demasiadas clases (%lld)\n", ruta, iv.n);
+        intervalosLiberar(&iv);
+        return 1;
+    }
+    int num_clases = (int)iv.n;
+    double cargar = tiempoMonotonico() - inicio;
+
+    if (soloBarrido) {
+        inicio = tiempoMonotonico();
+        qsort(iv.inicio, num_clases, sizeof(int64_t), compararTiempos64);
+        qsort(iv.fin, num_clases, sizeof(int64_t), compararTiempos64);
+        double ordenar = tiempoMonotonico() - inicio;
+        inicio = tiempoMonotonico();
+        int salones = minimoSalonesBarrido(iv.inicio, iv.fin, num_clases);
+        double barrer = tiempoMonotonico() - inicio;
+        intervalosLiberar(&iv);
+        printf("%d clases de %s   salones: %d   cargar: %.6f s   ordenar: %.6f s   barrido: %.6f s\n",
+               num_clases, ruta, salones, cargar, ordenar, barrer);
+        return 0;
+    }
+
+    inicio = tiempoMonotonico();
+    Clase *clases = malloc((size_t)(num_clases > 0 ? num_clases : 1) * sizeof(Clase));
+    int *salonDeClase = malloc((size_t)(num_clases > 0 ? num_clases : 1) * sizeof(int));
+    if (clases == NULL || salonDeClase == NULL) {
+        printf("Error: no hay memoria para %d clases\n", num_clases);
+        free(clases);
+        free(salonDeClase);
+        intervalosLiberar(&iv);
+        return 1;
+    }
+    for (int i = 0; i < num_clases; i++) {
+        clases[i].inicio = iv.inicio[i];
+        clases[i].fin = iv.fin[i];
+        clases[i].id = iv.id[i];
+    }
+    intervalosLiberar(&iv);
+    cargar += tiempoMonotonico() - inicio;
+
+    inicio = tiempoMonotonico();
+    qsort(clases, num_clases, sizeof(Clase), compararClases);
+    double ordenar = tiempoMonotonico() - inicio;
+
+    inicio = tiempoMonotonico();
+    int salones = asignarSalones(clases, num_clases, imprimir, salonDeClase);
+    double asignar = tiempoMonotonico() - inicio;
+    if (salones < 0) {
+        printf("Error: no hay memoria para los salones\n");
+        free(clases);
+        free(salonDeClase);
+        return 1;
+    }
+    if (imprimir) {
+        printf("Clases de cada salón:\n");
+        imprimirSalones(clases, num_clases, salonDeClase, salones);
+    }
+    printf("%d clases de %s   salones: %d   cargar: %.6f s   ordenar: %.6f s   asignar: %.6f s\n",
+           num_clases, ruta, salones, cargar, ordenar, asignar);
+    free(clases);
+    free(salonDeClase);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        const char *rutaEntrada = NULL;
+        int horaTarde = 0, imprimir = 0, soloBarrido = 0;
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--entrada") == 0 && i + 1 < argc) {
+                rutaEntrada = argv[++i];
+            } else if (strcmp(argv[i], "--reloj") == 0 && i + 1 < argc) {
+                horaTarde = atoi(argv[++i]);
+            } else if (strcmp(argv[i], "--imprimir") == 0) {
+                imprimir = 1;
+            } else if (strcmp(argv[i], "--barrido") == 0) {
+                soloBarrido = 1;
+            } else {
+                printf("Opcion no reconocida: %s\n", argv[i]);
+                exit(1);
+            }
+        }
+        if (rutaEntrada == NULL) {
+            printf("Error: se necesita --entrada archivo\n");
+            return 1;
+        }
+        return asignarDesdeArchivo(rutaEntrada, horaTarde, imprimir, soloBarrido);
+    }
+
+    // Definimos las clases según el diagrama
+    // Cada clase tiene: tiempo de inicio, tiempo de fin, y un identificador.
+    // Las horas están escritas como en el diagrama (930 = 9:30, sin indicar mañana o tarde);
+    // antes de usarlas se convierten a minutos desde la medianoche
+    Clase clases[] = {
+        {9, 10, 1},      // Clase 1 de 9:00 a 10:00
+        {930, 1030, 2},  // Clase 2 de 9:30 a 10:30
+        {10, 11, 3},     // Clase 3 de 10:00 a 11:00
+        {11, 1230, 4},   // Clase 4 de 11:00 a 12:30
+        {12, 130, 5},    // Clase 5 de 12:00 a 1:30
+        {1230, 230, 6},  // Clase 6 de 12:30 a 2:30
+        {130, 230, 7},   // Clase 7 de 1:30 a 2:30
+        {230, 4, 8},     // Clase 8 de 2:30 a 4:00
+        {3, 330, 9},     // Clase 9 de 3:00 a 3:30
+        {330, 430, 10}   // Clase 10 de 3:30 a 4:30
+    };
+
+    int num_clases = sizeof(clases) / sizeof(clases[0]);
+
+    // Las clases van de 9:00 a 4:30, así que las horas antes de las 8 son de la tarde
+    for (int i = 0; i < num_clases; i++) {
+        clases[i].inicio = minutosDeReloj(clases[i].inicio, 8);
+        clases[i].fin = minutosDeReloj(clases[i].fin, 8);
+    }
+    tiemposDeReloj = 1;
+
+    printf("Problema: Asignar %d clases al mínimo número de salones\n\n", num_clases);
+
+    // PASO 1: Ordenar las clases por tiempo de inicio
+    // Esto es crucial porque procesamos las clases en orden cronológico
+    printf("PASO 1: Ordenando clases por tiempo de inicio...\n");
+    qsort(clases, num_clases, sizeof(Clase), compararClases);
+
+    printf("Clases ordenadas:\n");
+    for (int i = 0; i < num_clases; i++) {
+        printf("  Clase %lld: inicio=", clases[i].id);
+        imprimirTiempo(clases[i].inicio);
+        printf(", fin=");
+        imprimirTiempo(clases[i].fin);
+        printf("\n");
+    }
+    printf("\n");
+
+    int salonDeClase[sizeof(clases) / sizeof(clases[0])];
+    int num_salones_usados = asignarSalones(clases, num_clases, 1, salonDeClase);
+    if (num_salones_usados < 0) {
+        printf("Error: no hay memoria para los salones\n");
+        return 1;
+    }
+
+    // PASO 4: Mostrar resultados
+    printf("Número mínimo de salones necesarios: %d\n", num_salones_usados);
+    printf("Clases de cada salón:\n");
+    imprimirSalones(clases, num_clases, salonDeClase, num_salones_usados);
     
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,1170 @@
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../Comun/intervalos.h"
+#include "../Comun/medicion.h"
+#include "../Comun/generador.h"
+
+/**
+ * Asignación de salones en línea
+ *
+ * salonesAvido.c resuelve un lote fijo de clases: ordena y asigna todo de nuevo. Aquí el horario
+ * cambia clase por clase (se agregan y se cancelan) y cada cambio toca solo los salones afectados:
+ *  - Cada salón guarda sus clases en un treap ordenado por inicio. Como no se traslapan, la clase
+ *    con el mayor inicio antes de que termine la nueva es la única que puede chocar con ella.
+ *  - Una clase nueva va al primer salón que la admite (primer ajuste), o a uno nuevo. Para no
+ *    revisar el treap de cada salón, el tiempo se divide en cubetas y cada cubeta tiene un mapa de
+ *    bits con los salones que tienen alguna clase en ella: solo se revisan los salones libres en
+ *    todas las cubetas que la clase cubre completas.
+ *  - Al cancelar una clase queda un hueco en su salón; las clases del último salón que caben en
+ *    ese hueco bajan a él, y si el último salón se vacía se cierra.
+ *  - Un árbol de segmentos sobre el tiempo cuenta las clases que ocurren en cada instante; su máximo
+ *    es el mínimo de salones que necesita el horario actual (con intervalos, el máximo de clases
+ *    simultáneas siempre alcanza). Cada cambio es una suma en un rango, O(log H).
+ *  - El primer ajuste y esa reparación dejan salones de más. Un barrido en el tiempo los vacía unos
+ *    pasos en cada cambio: la siguiente clase de un salón sobrante baja a un salón que la admite o
+ *    intercambia un tramo con uno que está libre cuando ella empieza. Con clases aleatorias quedan
+ *    menos de 2% salones de más (--benchmark 100000 --operaciones 1000000 termina con 1158 salones
+ *    y mínimo 1141; sin el barrido eran 1380 y 1155) a cambio de unos 8 us más por cambio.
+ * Las clases son intervalos [inicio, fin) de duración positiva, dentro de [origen, origen + H).
+ *
+ * Compilación: gcc -O2 salonesEnLinea.c -o salonesEnLinea
+ * Ejecución:   ./salonesEnLinea [opciones] < cambios.txt
+ *                  Cada línea es "+ id inicio fin" para agregar una clase o "- id" para cancelarla;
+ *                  se ignoran las líneas vacías y las que empiezan con #. Por cada cambio escribe el
+ *                  salón, los salones abiertos y el mínimo.
+ *              ./salonesEnLinea --benchmark n [--operaciones m] [--semilla s] [--verificar]
+ *                  Agrega n clases aleatorias y luego hace m cambios (cancelar una clase y agregar
+ *                  otra), y reporta la latencia de cada tipo de cambio.
+ * Opciones:
+ *   --entrada {archivo}   Lee los cambios de un archivo en lugar de la entrada estándar
+ *   --cargar {archivo}    Agrega primero las clases del archivo (ver Comun/intervalos.h)
+ *   --reloj {h}           Los tiempos son horas de reloj (930 = 9:30); las menores que h son de la tarde
+ *   --origen {t}          Primer instante del horario (por defecto 0)
+ *   --horizonte {H}       Instantes del horario (por defecto 10080, una semana en minutos)
+ * Ejemplo:
+ *              printf "+ 1 900 1030\n+ 2 10 11\n+ 3 1030 12\n- 1\n" | ./salonesEnLinea --reloj 8
+ */
+
+// Una semana en minutos
+#define HORIZONTE_POR_DEFECTO 10080
+
+// Ancho de las cubetas de tiempo con que se busca salón. Una clase solo descarta salones con las
+// cubetas que cubre completas, así que el ancho debe ser menor que una clase típica: con 10
+// minutos una clase de 30 cubre al menos dos, sin importar el horizonte.
+#define ANCHO_CUBETA 10
+
+// Las cubetas ocupan cubetas * salones / 8 bytes; horizontes de más de ANCHO_CUBETA * 2^16
+// instantes (unos 15 meses en minutos) usan cubetas más anchas para no pasar de ese número
+#define MAXIMO_CUBETAS (1 << 16)
+
+// Clases que el barrido de salones sobrantes baja en cada cambio (ver asignadorBarrer)
+#define PASOS_BARRIDO 2
+
+/*
+ * Clase activa. También es el nodo del treap de su salón: los índices del arreglo sustituyen a
+ * punteros y las clases canceladas se reutilizan con una lista de libres (encadenada por izq).
+ */
+typedef struct {
+    long long id;
+    long long inicio;
+    long long fin;
+    int salon;            // Salón donde está (desde 0), -1 si el lugar está libre
+    unsigned prioridad;
+    int izq, der;         // Hijos dentro del treap del salón, -1 si no hay
+} ClaseEnLinea;
+
+typedef struct {
+    int raiz;             // Treap de las clases del salón, -1 si está vacío
+    int clases;
+} SalonEnLinea;
+
+/*
+ * Árbol de segmentos sobre el tiempo con suma en rango y máximo global. maximo[v] es el máximo del
+ * rango de v contando solo las sumas hechas dentro de él; pendiente[v] es lo que se sumó al rango
+ * completo de v. Así no hace falta propagar nada hacia abajo y el máximo global es maximo[1].
+ */
+typedef struct {
+    int *maximo;
+    int *pendiente;
+    int hojas;            // Potencia de 2 mayor o igual que el horizonte
+} ArbolTiempo;
+
+// Tabla de dispersión id -> clase, con direccionamiento abierto
+typedef struct {
+    long long *ids;
+    int *clase;           // -1 en las casillas vacías
+    int capacidad;        // Potencia de 2
+    int ocupadas;
+} TablaIds;
+
+typedef struct {
+    ClaseEnLinea *clases;
+    int capacidadClases;
+    int usadas;           // Lugares de clases tocados alguna vez
+    int libre;            // Cabeza de la lista de lugares libres, -1 si vacía
+    int activas;
+    SalonEnLinea *salones;
+    int capacidadSalones;
+    int abiertos;         // Salones hasta el último que tiene clases
+    unsigned long long *ocupados;  // Bit s de la fila b: el salón s tiene una clase en la cubeta b
+    int palabrasSalones;  // Palabras de 64 bits de cada fila (capacidadSalones / 64)
+    int cubetas;
+    long long anchoCubeta;
+    long long barrido;    // Instante donde sigue el barrido que vacía los salones sobrantes
+    ArbolTiempo tiempo;
+    long long origen;
+    long long horizonte;
+    TablaIds tabla;
+    GeneradorAleatorio prioridades;   // Prioridades de los treaps
+    int imprimir;         // Escribe las clases que cambian de salón
+    char error[128];      // Descripción del último cambio rechazado
+} Asignador;
+
+/*
+ÁRBOL DE SEGMENTOS
+*/
+int tiempoCrear(ArbolTiempo *a, long long horizonte) {
+    a->hojas = 1;
+    while (a->hojas < horizonte) {
+        a->hojas *= 2;
+    }
+    a->maximo = calloc(2 * (size_t)a->hojas, sizeof(int));
+    a->pendiente = calloc(2 * (size_t)a->hojas, sizeof(int));
+    return a->maximo != NULL && a->pendiente != NULL;
+}
+
+// Suma valor a los instantes [desde, hasta) dentro del nodo v, que cubre [izq, der)
+void tiempoSumarEn(ArbolTiempo *a, int v, int izq, int der, int desde, int hasta, int valor) {
+    if (hasta <= izq || der <= desde) {
+        return;
+    }
+    if (desde <= izq && der <= hasta) {
+        a->maximo[v] += valor;
+        a->pendiente[v] += valor;
+        return;
+    }
+    int mitad = izq + (der - izq) / 2;
+    tiempoSumarEn(a, 2 * v, izq, mitad, desde, hasta, valor);
+    tiempoSumarEn(a, 2 * v + 1, mitad, der, desde, hasta, valor);
+    int mayor = a->maximo[2 * v] > a->maximo[2 * v + 1] ? a->maximo[2 * v] : a->maximo[2 * v + 1];
+    a->maximo[v] = mayor + a->pendiente[v];
+}
+
+void tiempoSumar(ArbolTiempo *a, int desde, int hasta, int valor) {
+    tiempoSumarEn(a, 1, 0, a->hojas, desde, hasta, valor);
+}
+
+void tiempoLiberar(ArbolTiempo *a) {
+    free(a->maximo);
+    free(a->pendiente);
+}
+
+/*
+TABLA DE IDENTIFICADORES
+Sondeo lineal; al borrar se recorren hacia atrás las entradas siguientes en lugar de dejar marcas.
+*/
+int tablaCrear(TablaIds *t, int capacidad) {
+    t->capacidad = capacidad;
+    t->ocupadas = 0;
+    t->ids = malloc((size_t)capacidad * sizeof(long long));
+    t->clase = malloc((size_t)capacidad * sizeof(int));
+    if (t->ids == NULL || t->clase == NULL) {
+        return 0;
+    }
+    memset(t->clase, -1, (size_t)capacidad * sizeof(int));
+    return 1;
+}
+
+int tablaCasilla(const TablaIds *t, long long id) {
+    return (int)(((unsigned long long)id * 0x9E3779B97F4A7C15ull) >> 32) & (t->capacidad - 1);
+}
+
+// Clase con ese id, o -1 si no está
+int tablaBuscar(const TablaIds *t, long long id) {
+    for (int i = tablaCasilla(t, id); t->clase[i] >= 0; i = (i + 1) & (t->capacidad - 1)) {
+        if (t->ids[i] == id) {
+            return t->clase[i];
+        }
+    }
+    return -1;
+}
+
+// Guarda id -> clase; el id no debe estar. Duplica la tabla al pasar de la mitad de ocupación
+int tablaAgregar(TablaIds *t, long long id, int clase) {
+    if (2 * (t->ocupadas + 1) > t->capacidad) {
+        TablaIds nueva;
+        if (!tablaCrear(&nueva, 2 * t->capacidad)) {
+            free(nueva.ids);
+            free(nueva.clase);
+            return 0;
+        }
+        for (int i = 0; i < t->capacidad; i++) {
+            if (t->clase[i] >= 0) {
+                tablaAgregar(&nueva, t->ids[i], t->clase[i]);
+            }
+        }
+        free(t->ids);
+        free(t->clase);
+        *t = nueva;
+    }
+    int i = tablaCasilla(t, id);
+    while (t->clase[i] >= 0) {
+        i = (i + 1) & (t->capacidad - 1);
+    }
+    t->ids[i] = id;
+    t->clase[i] = clase;
+    t->ocupadas++;
+    return 1;
+}
+
+void tablaQuitar(TablaIds *t, long long id) {
+    int mascara = t->capacidad - 1;
+    int i = tablaCasilla(t, id);
+    while (t->clase[i] >= 0 && t->ids[i] != id) {
+        i = (i + 1) & mascara;
+    }
+    if (t->clase[i] < 0) {
+        return;
+    }
+    // Cada entrada siguiente de la cadena se mueve al hueco si su casilla ideal no queda entre ambos
+    for (int j = (i + 1) & mascara; t->clase[j] >= 0; j = (j + 1) & mascara) {
+        int ideal = tablaCasilla(t, t->ids[j]);
+        if (((j - ideal) & mascara) >= ((j - i) & mascara)) {
+            t->ids[i] = t->ids[j];
+            t->clase[i] = t->clase[j];
+            i = j;
+        }
+    }
+    t->clase[i] = -1;
+    t->ocupadas--;
+}
+
+void tablaLiberar(TablaIds *t) {
+    free(t->ids);
+    free(t->clase);
+}
+
+/*
+TREAP DE CADA SALÓN
+Ordenado por inicio y montículo por prioridad aleatoria. Las clases de un salón no se traslapan,
+así que ordenarlas por inicio también las ordena por fin.
+*/
+
+// Une dos treaps en los que todas las clases de izq empiezan antes que las de der
+int treapUnir(ClaseEnLinea *c, int izq, int der) {
+    if (izq < 0) {
+        return der;
+    }
+    if (der < 0) {
+        return izq;
+    }
+    if (c[izq].prioridad > c[der].prioridad) {
+        c[izq].der = treapUnir(c, c[izq].der, der);
+        return izq;
+    }
+    c[der].izq = treapUnir(c, izq, c[der].izq);
+    return der;
+}
+
+// Separa nodo en las clases que empiezan antes de t (*menores) y las demás (*resto)
+void treapSeparar(ClaseEnLinea *c, int nodo, long long t, int *menores, int *resto) {
+    if (nodo < 0) {
+        *menores = *resto = -1;
+    } else if (c[nodo].inicio < t) {
+        treapSeparar(c, c[nodo].der, t, &c[nodo].der, resto);
+        *menores = nodo;
+    } else {
+        treapSeparar(c, c[nodo].izq, t, menores, &c[nodo].izq);
+        *resto = nodo;
+    }
+}
+
+// Última clase que empieza antes de t, o -1
+int treapUltimaAntes(const ClaseEnLinea *c, int nodo, long long t) {
+    int mejor = -1;
+    while (nodo >= 0) {
+        if (c[nodo].inicio < t) {
+            mejor = nodo;
+            nodo = c[nodo].der;
+        } else {
+            nodo = c[nodo].izq;
+        }
+    }
+    return mejor;
+}
+
+// Primera clase que empieza en t o después, o -1
+int treapPrimeraDesde(const ClaseEnLinea *c, int nodo, long long t) {
+    int mejor = -1;
+    while (nodo >= 0) {
+        if (c[nodo].inicio >= t) {
+            mejor = nodo;
+            nodo = c[nodo].izq;
+        } else {
+            nodo = c[nodo].der;
+        }
+    }
+    return mejor;
+}
+
+// Quita del treap la clase que empieza en t y regresa la nueva raíz
+int treapQuitar(ClaseEnLinea *c, int nodo, long long t) {
+    if (nodo < 0) {
+        return -1;
+    }
+    if (c[nodo].inicio == t) {
+        return treapUnir(c, c[nodo].izq, c[nodo].der);
+    }
+    if (t < c[nodo].inicio) {
+        c[nodo].izq = treapQuitar(c, c[nodo].izq, t);
+    } else {
+        c[nodo].der = treapQuitar(c, c[nodo].der, t);
+    }
+    return nodo;
+}
+
+/*
+ * Un salón admite [inicio, fin) si la última de sus clases que empieza antes de fin ya terminó en
+ * inicio: las anteriores terminan antes de que ésa empiece. O(log k) esperado con k clases.
+ */
+int salonAdmite(const Asignador *a, int s, long long inicio, long long fin) {
+    int previa = treapUltimaAntes(a->clases, a->salones[s].raiz, fin);
+    return previa < 0 || a->clases[previa].fin <= inicio;
+}
+
+void salonInsertar(Asignador *a, int s, int clase) {
+    int menores, resto;
+    treapSeparar(a->clases, a->salones[s].raiz, a->clases[clase].inicio, &menores, &resto);
+    a->salones[s].raiz = treapUnir(a->clases, treapUnir(a->clases, menores, clase), resto);
+    a->salones[s].clases++;
+    a->clases[clase].salon = s;
+}
+
+/*
+CUBETAS DE TIEMPO
+La cubeta b cubre [origen + b * ancho, origen + (b + 1) * ancho).
+*/
+
+// Prende el bit del salón s en las cubetas que toca [inicio, fin)
+void cubetasOcupar(Asignador *a, int s, long long inicio, long long fin) {
+    unsigned long long bit = 1ull << (s & 63);
+    int ultima = (int)((fin - 1 - a->origen) / a->anchoCubeta);
+    for (int b = (int)((inicio - a->origen) / a->anchoCubeta); b <= ultima; b++) {
+        a->ocupados[(size_t)b * a->palabrasSalones + (s >> 6)] |= bit;
+    }
+}
+
+// Prende o apaga el bit del salón s en la cubeta b según las clases que tiene su treap
+void cubetaRevisar(Asignador *a, int s, int b) {
+    unsigned long long bit = 1ull << (s & 63);
+    long long desde = a->origen + b * a->anchoCubeta;
+    int previa = treapUltimaAntes(a->clases, a->salones[s].raiz, desde + a->anchoCubeta);
+    if (previa >= 0 && a->clases[previa].fin > desde) {
+        a->ocupados[(size_t)b * a->palabrasSalones + (s >> 6)] |= bit;
+    } else {
+        a->ocupados[(size_t)b * a->palabrasSalones + (s >> 6)] &= ~bit;
+    }
+}
+
+/*
+ * Después de quitar [inicio, fin) del treap del salón s, apaga su bit en las cubetas donde ya no le
+ * quedan clases. Las cubetas que la clase cubría completas quedan libres sin preguntar (las clases
+ * de un salón no se traslapan); solo las dos de los extremos se consultan en el treap.
+ */
+void cubetasDesocupar(Asignador *a, int s, long long inicio, long long fin) {
+    unsigned long long bit = 1ull << (s & 63);
+    int primera = (int)((inicio - a->origen) / a->anchoCubeta);
+    int ultima = (int)((fin - 1 - a->origen) / a->anchoCubeta);
+    for (int b = primera; b <= ultima; b++) {
+        if (b == primera || b == ultima) {
+            cubetaRevisar(a, s, b);
+        } else {
+            a->ocupados[(size_t)b * a->palabrasSalones + (s >> 6)] &= ~bit;
+        }
+    }
+}
+
+/*
+ * Primer salón que admite [inicio, fin), o a->abiertos si ninguno. Un salón con una clase en
+ * alguna de las cubetas que [inicio, fin) cubre completas no puede admitirla; de 64 en 64 salones
+ * se descartan ésos con las filas de esas cubetas y solo los demás se revisan en su treap.
+ */
+int asignadorBuscarSalon(const Asignador *a, long long inicio, long long fin) {
+    long long primera = (inicio - a->origen + a->anchoCubeta - 1) / a->anchoCubeta;
+    long long ultima = (fin - a->origen) / a->anchoCubeta;  // Cubetas completas: [primera, ultima)
+    for (int j = 0; 64 * j < a->abiertos; j++) {
+        unsigned long long libres = ~0ull;
+        for (long long b = primera; libres != 0 && b < ultima; b++) {
+            libres &= ~a->ocupados[(size_t)b * a->palabrasSalones + j];
+        }
+        while (libres != 0) {
+            int s = 64 * j + __builtin_ctzll(libres);
+            if (s >= a->abiertos) {
+                return a->abiertos;
+            }
+            if (salonAdmite(a, s, inicio, fin)) {
+                return s;
+            }
+            libres &= libres - 1;
+        }
+    }
+    return a->abiertos;
+}
+
+// Pasa las clases del subárbol (ya fuera del treap de su salón) al salón s y regresa cuántas son
+int salonMarcar(Asignador *a, int nodo, int s) {
+    int total = 0;
+    while (nodo >= 0) {
+        ClaseEnLinea *c = &a->clases[nodo];
+        if (a->imprimir) {
+            printf("  clase %lld: salón %d -> salón %d\n", c->id, c->salon + 1, s + 1);
+        }
+        cubetasDesocupar(a, c->salon, c->inicio, c->fin);
+        cubetasOcupar(a, s, c->inicio, c->fin);
+        c->salon = s;
+        total += 1 + salonMarcar(a, c->izq, s);
+        nodo = c->der;
+    }
+    return total;
+}
+
+/*
+ASIGNADOR
+*/
+int asignadorCrear(Asignador *a, long long origen, long long horizonte) {
+    memset(a, 0, sizeof(*a));
+    a->libre = -1;
+    a->origen = origen;
+    a->horizonte = horizonte;
+    a->barrido = origen;
+    generadorSembrar(&a->prioridades, 2463534242u);
+    if (horizonte < 1 || horizonte > (1 << 30)) {
+        snprintf(a->error, sizeof(a->error), "horizonte fuera de rango: %lld", horizonte);
+        return 0;
+    }
+    if (origen > LLONG_MAX - horizonte) {
+        snprintf(a->error, sizeof(a->error), "origen fuera de rango: %lld + %lld no cabe en 64 bits", origen,
+                 horizonte);
+        return 0;
+    }
+    a->anchoCubeta = (horizonte + MAXIMO_CUBETAS - 1) / MAXIMO_CUBETAS;
+    if (a->anchoCubeta < ANCHO_CUBETA) {
+        a->anchoCubeta = ANCHO_CUBETA;
+    }
+    a->cubetas = (int)((horizonte + a->anchoCubeta - 1) / a->anchoCubeta);
+    if (!tiempoCrear(&a->tiempo, horizonte) || !tablaCrear(&a->tabla, 1024)) {
+        snprintf(a->error, sizeof(a->error), "no hay memoria para el horizonte");
+        return 0;
+    }
+    return 1;
+}
+
+void asignadorLiberar(Asignador *a) {
+    free(a->clases);
+    free(a->salones);
+    free(a->ocupados);
+    tiempoLiberar(&a->tiempo);
+    tablaLiberar(&a->tabla);
+}
+
+// Mínimo de salones para las clases activas (máximo de clases simultáneas)
+int asignadorMinimo(const Asignador *a) {
+    return a->tiempo.maximo[1];
+}
+
+// Lugar para una clase nueva, de la lista de libres o del final del arreglo; -1 si no hay memoria
+int asignadorNuevaClase(Asignador *a) {
+    if (a->libre >= 0) {
+        int clase = a->libre;
+        a->libre = a->clases[clase].izq;
+        return clase;
+    }
+    if (a->usadas == a->capacidadClases) {
+        int nuevaCapacidad = a->capacidadClases ? 2 * a->capacidadClases : 1024;
+        ClaseEnLinea *nuevas = realloc(a->clases, (size_t)nuevaCapacidad * sizeof(ClaseEnLinea));
+        if (nuevas == NULL) {
+            return -1;
+        }
+        a->clases = nuevas;
+        a->capacidadClases = nuevaCapacidad;
+    }
+    return a->usadas++;
+}
+
+// Duplica los salones posibles; las filas de cubetas se copian con el nuevo ancho
+int asignadorCrecerSalones(Asignador *a) {
+    int nuevaCapacidad = a->capacidadSalones ? 2 * a->capacidadSalones : 64;
+    int nuevasPalabras = nuevaCapacidad / 64;
+    unsigned long long *ocupados = calloc((size_t)a->cubetas * nuevasPalabras, sizeof(unsigned long long));
+    SalonEnLinea *nuevos = realloc(a->salones, (size_t)nuevaCapacidad * sizeof(SalonEnLinea));
+    if (nuevos != NULL) {
+        a->salones = nuevos;
+    }
+    if (ocupados == NULL || nuevos == NULL) {
+        free(ocupados);
+        return 0;
+    }
+    for (int b = 0; b < a->cubetas && a->palabrasSalones > 0; b++) {
+        memcpy(ocupados + (size_t)b * nuevasPalabras, a->ocupados + (size_t)b * a->palabrasSalones,
+               (size_t)a->palabrasSalones * sizeof(unsigned long long));
+    }
+    free(a->ocupados);
+    a->ocupados = ocupados;
+    a->palabrasSalones = nuevasPalabras;
+    a->capacidadSalones = nuevaCapacidad;
+    return 1;
+}
+
+// Cierra los salones vacíos del final
+void asignadorRecortar(Asignador *a) {
+    while (a->abiertos > 0 && a->salones[a->abiertos - 1].clases == 0) {
+        a->abiertos--;
+    }
+}
+
+/*
+BARRIDO DE SALONES SOBRANTES
+Con m = asignadorMinimo(a), si una clase del salón s >= m empieza en t, a lo más m - 1 de los
+salones 0..m-1 están ocupados en t, así que alguno r está libre. Ninguno de los dos tiene una clase
+que cruce t, y pueden intercambiar las clases que empiezan desde t hasta el siguiente instante que
+tampoco cruza ninguna: la clase baja a r y lo que r tenía en ese tramo pasa a s, después de t.
+Recorriendo el tiempo en orden, las clases de los salones >= m solo quedan después del instante
+barrido; al llegar al final del horizonte esos salones están vacíos y se cierran. El barrido avanza
+unos pasos en cada cambio y vuelve a empezar al terminar, así que también recoge las clases que el
+primer ajuste manda a salones sobrantes.
+*/
+
+// Pasa al salón s las clases del subárbol y regresa cuántas son; las cubetas no se tocan
+int salonEtiquetar(Asignador *a, int nodo, int s) {
+    int total = 0;
+    while (nodo >= 0) {
+        ClaseEnLinea *c = &a->clases[nodo];
+        if (a->imprimir) {
+            printf("  clase %lld: salón %d -> salón %d\n", c->id, c->salon + 1, s + 1);
+        }
+        c->salon = s;
+        total += 1 + salonEtiquetar(a, c->izq, s);
+        nodo = c->der;
+    }
+    return total;
+}
+
+/*
+ * Intercambia entre los salones s y r las clases que empiezan en [t, fin), donde ninguno de los dos
+ * tiene una clase que cruce t ni fin. fin empieza en el final de la primera clase de s desde t y se
+ * corre al final de cualquier clase de s o r que lo cruce. Entre la cubeta de t y la de fin - 1 las
+ * filas solo tienen bits de esas clases y basta intercambiarlos; esas dos cubetas se revisan en el treap.
+ */
+void salonesIntercambiarTramo(Asignador *a, int s, int r, long long t) {
+    ClaseEnLinea *c = a->clases;
+    long long fin = c[treapPrimeraDesde(c, a->salones[s].raiz, t)].fin;
+    for (int cruza = 1; cruza;) {
+        cruza = 0;
+        int previaS = treapUltimaAntes(c, a->salones[s].raiz, fin);
+        int previaR = treapUltimaAntes(c, a->salones[r].raiz, fin);
+        if (previaS >= 0 && c[previaS].fin > fin) {
+            fin = c[previaS].fin;
+            cruza = 1;
+        }
+        if (previaR >= 0 && c[previaR].fin > fin) {
+            fin = c[previaR].fin;
+            cruza = 1;
+        }
+    }
+
+    int antesS, tramoS, despuesS, antesR, tramoR, despuesR;
+    treapSeparar(c, a->salones[s].raiz, t, &antesS, &tramoS);
+    treapSeparar(c, tramoS, fin, &tramoS, &despuesS);
+    treapSeparar(c, a->salones[r].raiz, t, &antesR, &tramoR);
+    treapSeparar(c, tramoR, fin, &tramoR, &despuesR);
+    int deS = salonEtiquetar(a, tramoS, r);
+    int deR = salonEtiquetar(a, tramoR, s);
+    a->salones[s].raiz = treapUnir(c, treapUnir(c, antesS, tramoR), despuesS);
+    a->salones[r].raiz = treapUnir(c, treapUnir(c, antesR, tramoS), despuesR);
+    a->salones[s].clases += deR - deS;
+    a->salones[r].clases += deS - deR;
+
+    int primera = (int)((t - a->origen) / a->anchoCubeta);
+    int ultima = (int)((fin - 1 - a->origen) / a->anchoCubeta);
+    for (int b = primera + 1; b < ultima; b++) {
+        unsigned long long *fila = a->ocupados + (size_t)b * a->palabrasSalones;
+        if (((fila[s >> 6] >> (s & 63)) ^ (fila[r >> 6] >> (r & 63))) & 1) {
+            fila[s >> 6] ^= 1ull << (s & 63);
+            fila[r >> 6] ^= 1ull << (r & 63);
+        }
+    }
+    cubetaRevisar(a, s, primera);
+    cubetaRevisar(a, r, primera);
+    cubetaRevisar(a, s, ultima);
+    cubetaRevisar(a, r, ultima);
+}
+
+// Pasa la clase k a otro salón r que la admite
+void asignadorMover(Asignador *a, int k, int r) {
+    ClaseEnLinea *c = &a->clases[k];
+    int s = c->salon;
+    if (a->imprimir) {
+        printf("  clase %lld: salón %d -> salón %d\n", c->id, s + 1, r + 1);
+    }
+    a->salones[s].raiz = treapQuitar(a->clases, a->salones[s].raiz, c->inicio);
+    a->salones[s].clases--;
+    cubetasDesocupar(a, s, c->inicio, c->fin);
+    c->izq = c->der = -1;
+    salonInsertar(a, r, k);
+    cubetasOcupar(a, r, c->inicio, c->fin);
+}
+
+/*
+ * Primera clase de los salones minimo..abiertos-1 que empieza en desde o después, o -1. Las cubetas se
+ * recorren en orden y en cada una solo se consultan los salones sobrantes con su bit prendido.
+ */
+int asignadorPrimeraSobrante(const Asignador *a, int minimo, long long desde) {
+    const ClaseEnLinea *c = a->clases;
+    for (int b = (int)((desde - a->origen) / a->anchoCubeta); b < a->cubetas; b++) {
+        const unsigned long long *fila = a->ocupados + (size_t)b * a->palabrasSalones;
+        long long finCubeta = a->origen + (b + 1) * a->anchoCubeta;
+        int mejor = -1;
+        for (int j = minimo >> 6; 64 * j < a->abiertos; j++) {
+            unsigned long long bits = fila[j];
+            if (j == minimo >> 6) {
+                bits &= ~0ull << (minimo & 63);
+            }
+            for (; bits != 0; bits &= bits - 1) {
+                int s = 64 * j + __builtin_ctzll(bits);
+                int k = treapPrimeraDesde(c, a->salones[s].raiz, desde);
+                if (k >= 0 && c[k].inicio < finCubeta && (mejor < 0 || c[k].inicio < c[mejor].inicio)) {
+                    mejor = k;
+                }
+            }
+        }
+        if (mejor >= 0) {
+            return mejor;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Un salón entre 0 y minimo - 1 sin clases en el instante t, o -1. Un salón sin bit en la cubeta b de t
+ * sirve sin consultar su treap. Si no hay, se revisan primero los que tienen libre la cubeta anterior
+ * o la siguiente (una de sus clases termina o empieza en b) y al final los que ocupan las tres.
+ */
+int asignadorSalonLibreEn(const Asignador *a, int minimo, long long t) {
+    int b = (int)((t - a->origen) / a->anchoCubeta);
+    const unsigned long long *fila = a->ocupados + (size_t)b * a->palabrasSalones;
+    const unsigned long long *antes = b > 0 ? fila - a->palabrasSalones : NULL;
+    const unsigned long long *despues = b + 1 < a->cubetas ? fila + a->palabrasSalones : NULL;
+    for (int vuelta = 0; vuelta < 3; vuelta++) {
+        for (int j = 0; 64 * j < minimo; j++) {
+            unsigned long long rodeados = (antes ? antes[j] : 0) & (despues ? despues[j] : 0);
+            unsigned long long revisar = vuelta == 0 ? ~fila[j] : vuelta == 1 ? fila[j] & ~rodeados : fila[j] & rodeados;
+            if (64 * j + 64 > minimo) {
+                revisar &= (1ull << (minimo & 63)) - 1;
+            }
+            for (; revisar != 0; revisar &= revisar - 1) {
+                int s = 64 * j + __builtin_ctzll(revisar);
+                if (vuelta == 0 || salonAdmite(a, s, t, t + 1)) {
+                    return s;
+                }
+            }
+        }
+    }
+    return -1;
+}
+
+/*
+ * Avanza el barrido hasta pasos clases mientras haya más salones abiertos que el mínimo. Cada paso
+ * busca la siguiente clase de un salón sobrante; si cabe completa en un salón menor que el mínimo se
+ * mueve ahí y si no intercambia un tramo con un salón libre cuando ella empieza.
+ */
+void asignadorBarrer(Asignador *a, int pasos) {
+    while (pasos > 0 && a->abiertos > asignadorMinimo(a)) {
+        int minimo = asignadorMinimo(a);
+        int k = asignadorPrimeraSobrante(a, minimo, a->barrido);
+        if (k < 0) {
+            a->barrido = a->origen;
+            pasos--;
+            continue;
+        }
+        long long t = a->clases[k].inicio;
+        a->barrido = t;
+        int r = asignadorBuscarSalon(a, t, a->clases[k].fin);
+        if (r < minimo) {
+            asignadorMover(a, k, r);
+            asignadorRecortar(a);
+            pasos--;
+            continue;
+        }
+        r = asignadorSalonLibreEn(a, minimo, t);
+        if (r < 0) {
+            a->barrido = t + 1;
+        } else {
+            salonesIntercambiarTramo(a, a->clases[k].salon, r, t);
+            asignadorRecortar(a);
+        }
+        pasos--;
+    }
+}
+
+/*
+asignadorAgregar - Agrega la clase [inicio, fin) con ese id al primer salón que la admite
+Regresa el salón (desde 0), o -1 con el motivo en a->error
+*/
+int asignadorAgregar(Asignador *a, long long id, long long inicio, long long fin) {
+    if (fin <= inicio) {
+        snprintf(a->error, sizeof(a->error), "la clase %lld no dura nada o termina antes de empezar", id);
+        return -1;
+    }
+    if (inicio < a->origen || fin > a->origen + a->horizonte) {
+        snprintf(a->error, sizeof(a->error), "la clase %lld queda fuera del horizonte", id);
+        return -1;
+    }
+    if (tablaBuscar(&a->tabla, id) >= 0) {
+        snprintf(a->error, sizeof(a->error), "la clase %lld ya existe", id);
+        return -1;
+    }
+
+    asignadorBarrer(a, PASOS_BARRIDO);
+    int s = asignadorBuscarSalon(a, inicio, fin);
+    if (s == a->capacidadSalones && !asignadorCrecerSalones(a)) {
+        snprintf(a->error, sizeof(a->error), "no hay memoria para más salones");
+        return -1;
+    }
+    int clase = asignadorNuevaClase(a);
+    if (clase < 0 || !tablaAgregar(&a->tabla, id, clase)) {
+        if (clase >= 0) {
+            a->clases[clase].salon = -1;
+            a->clases[clase].izq = a->libre;
+            a->libre = clase;
+        }
+        snprintf(a->error, sizeof(a->error), "no hay memoria para más clases");
+        return -1;
+    }
+    if (s == a->abiertos) {
+        a->salones[s].raiz = -1;
+        a->salones[s].clases = 0;
+        a->abiertos++;
+    }
+
+    ClaseEnLinea *c = &a->clases[clase];
+    c->id = id;
+    c->inicio = inicio;
+    c->fin = fin;
+    c->prioridad = (unsigned)(generadorSiguiente(&a->prioridades) >> 32);
+    c->izq = c->der = -1;
+    salonInsertar(a, s, clase);
+    cubetasOcupar(a, s, inicio, fin);
+    tiempoSumar(&a->tiempo, (int)(inicio - a->origen), (int)(fin - a->origen), 1);
+    a->activas++;
+    return s;
+}
+
+/*
+ * Repara el salón s después de que se abrió el hueco [desde, hasta): las clases del último salón
+ * que caben completas en el hueco son consecutivas en su treap, así que se separan y se unen al
+ * treap de s de una vez. Si el último salón se queda vacío se cierra. Regresa cuántas se movieron.
+ * Los salones intermedios que sobran los vacía el barrido (asignadorBarrer).
+ */
+int asignadorReparar(Asignador *a, int s, long long desde, long long hasta) {
+    int ultimo = a->abiertos - 1;
+    if (s >= ultimo) {
+        return 0;
+    }
+    ClaseEnLinea *c = a->clases;
+    int antes, enHueco, despues;
+    treapSeparar(c, a->salones[ultimo].raiz, desde, &antes, &enHueco);
+    treapSeparar(c, enHueco, hasta, &enHueco, &despues);
+    // Solo la última clase que empieza dentro del hueco puede terminar después de él
+    int mayor = treapUltimaAntes(c, enHueco, hasta);
+    if (mayor >= 0 && c[mayor].fin > hasta) {
+        int sobrante;
+        treapSeparar(c, enHueco, c[mayor].inicio, &enHueco, &sobrante);
+        despues = treapUnir(c, sobrante, despues);
+    }
+    a->salones[ultimo].raiz = treapUnir(c, antes, despues);
+    if (enHueco < 0) {
+        return 0;
+    }
+
+    int movidas = salonMarcar(a, enHueco, s);
+    a->salones[ultimo].clases -= movidas;
+    int menores, resto;
+    treapSeparar(c, a->salones[s].raiz, desde, &menores, &resto);
+    a->salones[s].raiz = treapUnir(c, treapUnir(c, menores, enHueco), resto);
+    a->salones[s].clases += movidas;
+    asignadorRecortar(a);
+    return movidas;
+}
+
+/*
+asignadorCancelar - Quita la clase con ese id y repara su salón
+Regresa el salón donde estaba (desde 0), o -1 con el motivo en a->error
+*/
+int asignadorCancelar(Asignador *a, long long id) {
+    int clase = tablaBuscar(&a->tabla, id);
+    if (clase < 0) {
+        snprintf(a->error, sizeof(a->error), "la clase %lld no existe", id);
+        return -1;
+    }
+    ClaseEnLinea *c = &a->clases[clase];
+    int s = c->salon;
+    long long inicio = c->inicio, fin = c->fin;
+    a->salones[s].raiz = treapQuitar(a->clases, a->salones[s].raiz, inicio);
+    a->salones[s].clases--;
+    cubetasDesocupar(a, s, inicio, fin);
+    tiempoSumar(&a->tiempo, (int)(inicio - a->origen), (int)(fin - a->origen), -1);
+    tablaQuitar(&a->tabla, id);
+    c->salon = -1;
+    c->izq = a->libre;
+    a->libre = clase;
+    a->activas--;
+
+    asignadorRecortar(a);
+    if (s < a->abiertos) {
+        // El hueco va del fin de la clase anterior al inicio de la siguiente
+        int raiz = a->salones[s].raiz;
+        int previa = treapUltimaAntes(a->clases, raiz, inicio);
+        int siguiente = treapPrimeraDesde(a->clases, raiz, inicio);
+        long long desde = previa < 0 ? a->origen : a->clases[previa].fin;
+        long long hasta = siguiente < 0 ? a->origen + a->horizonte : a->clases[siguiente].inicio;
+        asignadorReparar(a, s, desde, hasta);
+    }
+    asignadorBarrer(a, PASOS_BARRIDO);
+    return s;
+}
+
+int compararTiemposLargos(const void *a, const void *b) {
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+int salonRevisar(const Asignador *a, int nodo, int s, long long *ultimoFin, int *cuenta) {
+    if (nodo < 0) {
+        return 1;
+    }
+    const ClaseEnLinea *c = &a->clases[nodo];
+    if (!salonRevisar(a, c->izq, s, ultimoFin, cuenta)) {
+        return 0;
+    }
+    if (c->salon != s || c->inicio < *ultimoFin || tablaBuscar(&a->tabla, c->id) != nodo) {
+        return 0;
+    }
+    *ultimoFin = c->fin;
+    (*cuenta)++;
+    return salonRevisar(a, c->der, s, ultimoFin, cuenta);
+}
+
+/*
+ * Revisa la estructura completa: cada salón ordenado y sin traslapes, sus contadores, la tabla de
+ * ids, los mapas de las cubetas y el mínimo del árbol de segmentos contra un barrido de todas las clases activas.
+ * O(n log n); solo para pruebas. Regresa 1 si todo cuadra.
+ */
+int asignadorVerificar(const Asignador *a) {
+    long long *inicios = malloc((size_t)(a->activas + 1) * sizeof(long long));
+    long long *fines = malloc((size_t)(a->activas + 1) * sizeof(long long));
+    if (inicios == NULL || fines == NULL) {
+        free(inicios);
+        free(fines);
+        return 0;
+    }
+    int ok = a->abiertos == 0 || a->salones[a->abiertos - 1].clases > 0;
+    int total = 0;
+    for (int s = 0; ok && s < a->abiertos; s++) {
+        long long ultimoFin = a->origen;
+        int cuenta = 0;
+        ok = salonRevisar(a, a->salones[s].raiz, s, &ultimoFin, &cuenta) && cuenta == a->salones[s].clases;
+        total += cuenta;
+    }
+    ok = ok && total == a->activas && a->tabla.ocupadas == a->activas;
+    for (int s = 0; ok && s < a->capacidadSalones; s++) {
+        for (int b = 0; ok && b < a->cubetas; b++) {
+            long long desde = a->origen + b * a->anchoCubeta;
+            int previa = s < a->abiertos ? treapUltimaAntes(a->clases, a->salones[s].raiz, desde + a->anchoCubeta) : -1;
+            int usada = previa >= 0 && a->clases[previa].fin > desde;
+            ok = usada == (int)((a->ocupados[(size_t)b * a->palabrasSalones + (s >> 6)] >> (s & 63)) & 1);
+        }
+    }
+
+    int n = 0;
+    for (int i = 0; ok && i < a->usadas; i++) {
+        if (a->clases[i].salon >= 0) {
+            inicios[n] = a->clases[i].inicio;
+            fines[n] = a->clases[i].fin;
+            n++;
+        }
+    }
+    if (ok) {
+        qsort(inicios, n, sizeof(long long), compararTiemposLargos);
+        qsort(fines, n, sizeof(long long), compararTiemposLargos);
+        int maximo = 0;
+        for (int i = 0, terminadas = 0; i < n; i++) {
+            while (fines[terminadas] <= inicios[i]) {
+                terminadas++;
+            }
+            if (i + 1 - terminadas > maximo) {
+                maximo = i + 1 - terminadas;
+            }
+        }
+        ok = n == a->activas && maximo == asignadorMinimo(a) && a->abiertos >= maximo;
+    }
+    free(inicios);
+    free(fines);
+    return ok;
+}
+
+/*
+PROGRAMA
+*/
+
+// Lee un entero de 64 bits y avanza *p; regresa 0 si no hay número
+int leerTiempo(char **p, long long *valor) {
+    char *fin;
+    *valor = strtoll(*p, &fin, 10);
+    if (fin == *p) {
+        return 0;
+    }
+    *p = fin;
+    return 1;
+}
+
+void imprimirEstado(const Asignador *a) {
+    printf("   salones: %d   mínimo: %d   clases: %d\n", a->abiertos, asignadorMinimo(a), a->activas);
+}
+
+// Agrega las clases de un archivo completo (CSV o .ivl), en el orden en que vienen
+int cargarClases(Asignador *a, const char *ruta, int horaTarde) {
+    Intervalos iv;
+    if (!cargarIntervalos(ruta, &iv)) {
+        printf("Error: %s\n", iv.error);
+        return 0;
+    }
+    if (horaTarde > 0) {
+        intervalosNormalizarReloj(&iv, horaTarde);
+    }
+    double inicio = tiempoMonotonico();
+    for (long long i = 0; i < iv.n; i++) {
+        if (asignadorAgregar(a, iv.id[i], iv.inicio[i], iv.fin[i]) < 0) {
+            printf("Error: %s\n", a->error);
+            intervalosLiberar(&iv);
+            return 0;
+        }
+    }
+    printf("%lld clases de %s en %.6f s", iv.n, ruta, tiempoMonotonico() - inicio);
+    imprimirEstado(a);
+    intervalosLiberar(&iv);
+    return 1;
+}
+
+/*
+procesarCambios - Aplica las líneas "+ id inicio fin" y "- id" conforme llegan
+Los cambios rechazados se reportan y el proceso continúa. Regresa cuántos se rechazaron
+*/
+int procesarCambios(Asignador *a, FILE *archivo, int horaTarde) {
+    char linea[256];
+    int rechazados = 0;
+    while (fgets(linea, sizeof(linea), archivo) != NULL) {
+        char *p = linea;
+        while (*p == ' ' || *p == '\t') {
+            p++;
+        }
+        if (*p == '\0' || *p == '\n' || *p == '\r' || *p == '#') {
+            continue;
+        }
+        char operacion = *p++;
+        long long id, inicio, fin;
+        if (operacion == '+' && leerTiempo(&p, &id) && leerTiempo(&p, &inicio) && leerTiempo(&p, &fin)) {
+            if (horaTarde > 0) {
+                inicio = minutosDeReloj(inicio, horaTarde);
+                fin = minutosDeReloj(fin, horaTarde);
+            }
+            int s = asignadorAgregar(a, id, inicio, fin);
+            if (s < 0) {
+                printf("Error: %s\n", a->error);
+                rechazados++;
+                continue;
+            }
+            printf("+ %lld -> salón %d", id, s + 1);
+        } else if (operacion == '-' && leerTiempo(&p, &id)) {
+            int s = asignadorCancelar(a, id);
+            if (s < 0) {
+                printf("Error: %s\n", a->error);
+                rechazados++;
+                continue;
+            }
+            printf("- %lld (salón %d)", id, s + 1);
+        } else {
+            printf("Error: línea no reconocida: %s", linea);
+            rechazados++;
+            continue;
+        }
+        imprimirEstado(a);
+    }
+    return rechazados;
+}
+
+// Clase aleatoria de 30 minutos a 3 horas, en múltiplos de 5 minutos, dentro del horizonte
+void claseAleatoria(GeneradorAleatorio *g, const Asignador *a, long long *inicio, long long *fin) {
+    long long duracion = 30 + 5 * (long long)generadorRango(g, 31);
+    if (duracion > a->horizonte) {
+        duracion = a->horizonte;
+    }
+    *inicio = a->origen + (long long)generadorRango(g, (uint32_t)(a->horizonte - duracion + 1));
+    *fin = *inicio + duracion;
+}
+
+void reportarLatencias(const char *nombre, double tiempos[], int n) {
+    if (n == 0) {
+        return;
+    }
+    double suma = 0;
+    for (int i = 0; i < n; i++) {
+        suma += tiempos[i];
+    }
+    qsort(tiempos, n, sizeof(double), compararTiempos);
+    int rango = (int)((99LL * n + 99) / 100);
+    printf("%-9s %9d   promedio: %8.2f us   mediana: %8.2f us   p99: %8.2f us   máximo: %8.2f us\n",
+           nombre, n, 1e6 * suma / n, 1e6 * tiempos[n / 2], 1e6 * tiempos[rango - 1], 1e6 * tiempos[n - 1]);
+}
+
+/*
+ * Agrega n clases aleatorias y después hace m cambios, cada uno una cancelación de una clase activa
+ * al azar seguida de una clase nueva, midiendo cada operación por separado.
+ */
+int benchmarkEnLinea(Asignador *a, int n, int m, uint64_t semilla, int verificar) {
+    GeneradorAleatorio g;
+    generadorSembrar(&g, semilla);
+    long long *activas = malloc((size_t)(n > 0 ? n : 1) * sizeof(long long));
+    double *agregar = malloc((size_t)(n > 0 ? n : 1) * sizeof(double));
+    double *cambiarAgregar = malloc((size_t)(m > 0 ? m : 1) * sizeof(double));
+    double *cambiarCancelar = malloc((size_t)(m > 0 ? m : 1) * sizeof(double));
+    if (activas == NULL || agregar == NULL || cambiarAgregar == NULL || cambiarCancelar == NULL) {
+        printf("Error: no hay memoria para el benchmark\n");
+        free(activas);
+        free(agregar);
+        free(cambiarAgregar);
+        free(cambiarCancelar);
+        return 1;
+    }
+
+    long long siguienteId = 1;
+    int ok = 1;
+    for (int i = 0; ok && i < n; i++) {
+        long long inicio, fin;
+        claseAleatoria(&g, a, &inicio, &fin);
+        double t = tiempoMonotonico();
+        ok = asignadorAgregar(a, siguienteId, inicio, fin) >= 0;
+        agregar[i] = tiempoMonotonico() - t;
+        activas[i] = siguienteId++;
+    }
+    if (ok) {
+        printf("%d clases agregadas", n);
+        imprimirEstado(a);
+    }
+    if (ok && verificar) {
+        ok = asignadorVerificar(a);
+        printf("Verificación después de agregar: %s\n", ok ? "correcta" : "FALLÓ");
+    }
+
+    for (int i = 0; ok && i < m && n > 0; i++) {
+        int k = (int)generadorRango(&g, (uint32_t)n);
+        double t = tiempoMonotonico();
+        ok = asignadorCancelar(a, activas[k]) >= 0;
+        cambiarCancelar[i] = tiempoMonotonico() - t;
+
+        long long inicio, fin;
+        claseAleatoria(&g, a, &inicio, &fin);
+        t = tiempoMonotonico();
+        ok = ok && asignadorAgregar(a, siguienteId, inicio, fin) >= 0;
+        cambiarAgregar[i] = tiempoMonotonico() - t;
+        activas[k] = siguienteId++;
+    }
+    if (!ok) {
+        printf("Error: %s\n", a->error);
+    } else {
+        if (n > 0 && m > 0) {
+            printf("%d cambios aplicados", m);
+            imprimirEstado(a);
+        }
+        if (verificar) {
+            ok = asignadorVerificar(a);
+            printf("Verificación después de los cambios: %s\n", ok ? "correcta" : "FALLÓ");
+        }
+        reportarLatencias("agregar", agregar, n);
+        if (n > 0) {
+            reportarLatencias("cancelar", cambiarCancelar, m);
+            reportarLatencias("reagregar", cambiarAgregar, m);
+        }
+    }
+    free(activas);
+    free(agregar);
+    free(cambiarAgregar);
+    free(cambiarCancelar);
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char *argv[]) {
+    const char *rutaEntrada = NULL, *rutaCarga = NULL;
+    int horaTarde = 0, verificar = 0;
+    int benchmark = -1, operaciones = 100000;
+    long long origen = 0, horizonte = HORIZONTE_POR_DEFECTO;
+    uint64_t semilla = 12345;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--entrada") == 0 && i + 1 < argc) {
+            rutaEntrada = argv[++i];
+        } else if (strcmp(argv[i], "--cargar") == 0 && i + 1 < argc) {
+            rutaCarga = argv[++i];
+        } else if (strcmp(argv[i], "--reloj") == 0 && i + 1 < argc) {
+            horaTarde = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--origen") == 0 && i + 1 < argc) {
+            origen = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--horizonte") == 0 && i + 1 < argc) {
+            horizonte = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc) {
+            benchmark = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--operaciones") == 0 && i + 1 < argc) {
+            operaciones = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--semilla") == 0 && i + 1 < argc) {
+            semilla = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--verificar") == 0) {
+            verificar = 1;
+        } else {
+            printf("Opcion no reconocida: %s\n", argv[i]);
+            exit(1);
+        }
+    }
+
+    Asignador asignador;
+    if (!asignadorCrear(&asignador, origen, horizonte)) {
+        printf("Error: %s\n", asignador.error);
+        asignadorLiberar(&asignador);
+        return 1;
+    }
+    int resultado = 0;
+    if (benchmark >= 0) {
+        resultado = benchmarkEnLinea(&asignador, benchmark, operaciones, semilla, verificar);
+    } else {
+        asignador.imprimir = 1;
+        if (rutaCarga != NULL && !cargarClases(&asignador, rutaCarga, horaTarde)) {
+            asignadorLiberar(&asignador);
+            return 1;
+        }
+        FILE *archivo = rutaEntrada ? fopen(rutaEntrada, "r") : stdin;
+        if (archivo == NULL) {
+            printf("Error: No se pudo abrir %s\n", rutaEntrada);
+            asignadorLiberar(&asignador);
+            return 1;
+        }
+        resultado = procesarCambios(&asignador, archivo, horaTarde) > 0;
+        if (archivo != stdin) {
+            fclose(archivo);
+        }
+        if (verificar) {
+            printf("Verificación: %s\n", asignadorVerificar(&asignador) ? "correcta" : "FALLÓ");
+        }
+    }
+    asignadorLiberar(&asignador);
+    return resultado;
+}